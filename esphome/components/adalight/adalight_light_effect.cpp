@@ -1,6 +1,8 @@
 #include "adalight_light_effect.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace adalight {
 
@@ -20,24 +22,16 @@ void AdalightLightEffect::start() {
 }
 
 void AdalightLightEffect::stop() {
-  frame_.resize(0);
+  reset_frame_();
+  this->frame_.clear();
+  this->frame_.shrink_to_fit();
 
   AddressableLightEffect::stop();
 }
 
-unsigned int AdalightLightEffect::get_frame_size_(int led_count) const {
-  // 3 bytes: Ada
-  // 2 bytes: LED count
-  // 1 byte: checksum
-  // 3 bytes per LED
-  return 3 + 2 + 1 + led_count * 3;
-}
-
-void AdalightLightEffect::reset_frame_(light::AddressableLight &it) {
-  int buffer_capacity = get_frame_size_(it.size());
-
-  frame_.clear();
-  frame_.reserve(buffer_capacity);
+void AdalightLightEffect::reset_frame_() {
+  this->state_ = HEADER;
+  this->header_size_ = 0;
 }
 
 void AdalightLightEffect::blank_all_leds_(light::AddressableLight &it) {
@@ -58,84 +52,120 @@ void AdalightLightEffect::apply(light::AddressableLight &it, const Color &curren
 
   if (!this->last_reset_) {
     ESP_LOGW(TAG, "Frame: Reset.");
-    reset_frame_(it);
+    reset_frame_();
     blank_all_leds_(it);
     this->last_reset_ = now;
   }
 
-  if (!this->frame_.empty() && now - this->last_byte_ >= ADALIGHT_RECEIVE_TIMEOUT) {
-    ESP_LOGW(TAG, "Frame: Receive timeout (size=%zu).", this->frame_.size());
-    reset_frame_(it);
+  const bool in_frame = this->state_ == DATA || this->header_size_ > 0;
+  if (in_frame && now - this->last_byte_ >= ADALIGHT_RECEIVE_TIMEOUT) {
+    ESP_LOGW(TAG, "Frame: Receive timeout (bytes=%u).", this->frame_bytes_);
+    reset_frame_();
     blank_all_leds_(it);
   }
 
-  if (this->available() > 0) {
-    ESP_LOGV(TAG, "Frame: Available (size=%d).", this->available());
+  if (this->frame_.size() != it.size() * 3u) {
+    this->frame_.resize(it.size() * 3u);
+    reset_frame_();
   }
 
-  while (this->available() != 0) {
-    uint8_t data;
-    if (!this->read_byte(&data))
+  int available = this->available();
+  if (available > 0) {
+    ESP_LOGV(TAG, "Frame: Available (size=%d).", available);
+  }
+
+  // Read in blocks, which is much cheaper than a virtual call per byte at high baud rates
+  while (available > 0) {
+    const size_t len = std::min<size_t>(available, READ_BUFFER_SIZE);
+    if (!this->read_array(this->read_buffer_, len))
       break;
-    this->frame_.push_back(data);
     this->last_byte_ = now;
+    this->parse_(it, this->read_buffer_, len);
+    available -= len;
+    if (available == 0)
+      available = this->available();
+  }
+}
 
-    switch (this->parse_frame_(it)) {
-      case INVALID:
-        ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=%d).", this->frame_.size(), this->frame_[0]);
-        reset_frame_(it);
-        break;
+void AdalightLightEffect::parse_(light::AddressableLight &it, const uint8_t *data, size_t len) {
+  const uint8_t *end = data + len;
+
+  while (data != end) {
+    if (this->state_ == HEADER) {
+      // Skip to the next possible start of a frame
+      if (this->header_size_ == 0) {
+        const auto *start = static_cast<const uint8_t *>(memchr(data, 'A', end - data));
+        if (start == nullptr)
+          return;
+        data = start;
+      }
+
+      while (data != end && this->state_ == HEADER) {
+        if (!add_header_byte_(*data)) {
+          ESP_LOGD(TAG, "Frame: Invalid header (size=%u, first=%d).", this->header_size_, this->header_[0]);
+          // The rejected byte may start the next frame
+          this->header_size_ = 0;
+          if (*data != 'A')
+            data++;
+          break;
+        }
+        data++;
+      }
+      continue;
+    }
 
-      case PARTIAL:
-        break;
+    // Stage the LED data, the strip keeps showing the previous frame until this one is complete
+    const size_t count = std::min<size_t>(end - data, this->frame_size_ - this->frame_bytes_);
+    if (this->frame_bytes_ < this->frame_.size()) {
+      memcpy(this->frame_.data() + this->frame_bytes_, data,
+             std::min<size_t>(count, this->frame_.size() - this->frame_bytes_));
+    }
+    this->frame_bytes_ += count;
+    data += count;
 
-      case CONSUMED:
-        ESP_LOGV(TAG, "Frame: Consumed (size=%zu).", this->frame_.size());
-        reset_frame_(it);
-        break;
+    if (this->frame_bytes_ == this->frame_size_) {
+      ESP_LOGV(TAG, "Frame: Consumed (leds=%u).", this->frame_size_ / 3);
+      show_frame_(it);
+      reset_frame_();
     }
   }
 }
 
-AdalightLightEffect::Frame AdalightLightEffect::parse_frame_(light::AddressableLight &it) {
-  if (frame_.empty())
-    return INVALID;
-
-  // Check header: `Ada`
-  if (frame_[0] != 'A')
-    return INVALID;
-  if (frame_.size() > 1 && frame_[1] != 'd')
-    return INVALID;
-  if (frame_.size() > 2 && frame_[2] != 'a')
-    return INVALID;
-
-  // 3 bytes: Count Hi, Count Lo, Checksum
-  if (frame_.size() < 6)
-    return PARTIAL;
-
-  // Check checksum
-  uint16_t checksum = frame_[3] ^ frame_[4] ^ 0x55;
-  if (checksum != frame_[5])
-    return INVALID;
-
-  // Check if we received the full frame
-  uint16_t led_count = (frame_[3] << 8) + frame_[4] + 1;
-  auto buffer_size = get_frame_size_(led_count);
-  if (frame_.size() < buffer_size)
-    return PARTIAL;
-
-  // Apply lights
-  auto accepted_led_count = std::min<int>(led_count, it.size());
-  uint8_t *led_data = &frame_[6];
-
-  for (int led = 0; led < accepted_led_count; led++, led_data += 3) {
-    auto white = std::min(std::min(led_data[0], led_data[1]), led_data[2]);
-
-    it[led].set(Color(led_data[0], led_data[1], led_data[2], white));
+bool AdalightLightEffect::add_header_byte_(uint8_t data) {
+  this->header_[this->header_size_++] = data;
+
+  switch (this->header_size_) {
+    case 1:
+      return data == 'A';
+    case 2:
+      return data == 'd';
+    case 3:
+      return data == 'a';
+    case HEADER_SIZE: {
+      // Check checksum
+      uint8_t checksum = this->header_[3] ^ this->header_[4] ^ 0x55;
+      if (checksum != this->header_[5])
+        return false;
+
+      this->frame_size_ = ((this->header_[3] << 8) + this->header_[4] + 1) * 3;
+      this->frame_bytes_ = 0;
+      this->state_ = DATA;
+      return true;
+    }
+    default:
+      return true;
   }
+}
+
+void AdalightLightEffect::show_frame_(light::AddressableLight &it) {
+  const int leds = std::min<int>(this->frame_size_ / 3, it.size());
+  const uint8_t *rgb = this->frame_.data();
+  for (int led = 0; led < leds; led++, rgb += 3) {
+    auto white = std::min(std::min(rgb[0], rgb[1]), rgb[2]);
 
+    it[led].set(Color(rgb[0], rgb[1], rgb[2], white));
+  }
   it.schedule_show();
-  return CONSUMED;
 }
 
 }  // namespace adalight
@@ -18,21 +18,38 @@ class AdalightLightEffect : public light::AddressableLightEffect, public uart::U
   void apply(light::AddressableLight &it, const Color &current_color) override;
 
  protected:
-  enum Frame {
-    INVALID,
-    PARTIAL,
-    CONSUMED,
+  // 3 bytes: Ada
+  // 2 bytes: LED count
+  // 1 byte: checksum
+  static const uint8_t HEADER_SIZE = 6;
+  static constexpr size_t READ_BUFFER_SIZE = 256;
+
+  enum State : uint8_t {
+    HEADER,
+    DATA,
   };
 
-  unsigned int get_frame_size_(int led_count) const;
-  void reset_frame_(light::AddressableLight &it);
+  void reset_frame_();
   void blank_all_leds_(light::AddressableLight &it);
-  Frame parse_frame_(light::AddressableLight &it);
+  /// Parse received bytes, showing a frame once all of its LEDs arrived.
+  void parse_(light::AddressableLight &it, const uint8_t *data, size_t len);
+  /// Add one header byte, returns false if the header turned out to be invalid.
+  bool add_header_byte_(uint8_t data);
+  void show_frame_(light::AddressableLight &it);
 
   uint32_t last_ack_{0};
   uint32_t last_byte_{0};
   uint32_t last_reset_{0};
+
+  State state_{HEADER};
+  uint8_t header_[HEADER_SIZE];
+  uint8_t header_size_{0};
+  /// LED data of the frame being received, only written to the strip when the frame is complete so it never shows
+  /// part of one. Holds 3 bytes for every LED of the strip, data for LEDs beyond it is dropped.
   std::vector<uint8_t> frame_;
+  uint32_t frame_bytes_{0};
+  uint32_t frame_size_{0};
+  uint8_t read_buffer_[READ_BUFFER_SIZE];
 };
 
 }  // namespace adalight
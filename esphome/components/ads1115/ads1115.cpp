@@ -2,6 +2,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/hal.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace ads1115 {
 
@@ -83,7 +85,7 @@ void ADS1115Component::dump_config() {
     ESP_LOGCONFIG(TAG, "    Resolution: %u", sensor->get_resolution());
   }
 }
-float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
+uint16_t ADS1115Component::config_for_(ADS1115Sensor *sensor) const {
   uint16_t config = this->prev_config_;
   // Multiplexer
   //        0bxBBBxxxxxxxxxxxx
@@ -99,14 +101,26 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
     // Start conversion
     config |= 0b1000000000000000;
   }
+  return config;
+}
+bool ADS1115Component::configure_(ADS1115Sensor *sensor, bool *started) {
+  uint16_t config = this->config_for_(sensor);
+  *started = !this->continuous_mode_ || this->prev_config_ != config;
+  if (!*started)
+    return true;
+  if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
+    this->status_set_warning();
+    return false;
+  }
+  this->prev_config_ = config;
+  return true;
+}
+float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
+  bool started;
+  if (!this->configure_(sensor, &started))
+    return NAN;
 
-  if (!this->continuous_mode_ || this->prev_config_ != config) {
-    if (!this->write_byte_16(ADS1115_REGISTER_CONFIG, config)) {
-      this->status_set_warning();
-      return NAN;
-    }
-    this->prev_config_ = config;
-
+  if (started) {
     // about 1.2 ms with 860 samples per second
     delay(2);
 
@@ -114,6 +128,7 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
     // to ensure conversion is taking place with the correct settings
     // can we use the rdy pin to trigger when a conversion is done?
     if (!this->continuous_mode_) {
+      uint16_t config;
       uint32_t start = millis();
       while (this->read_byte_16(ADS1115_REGISTER_CONFIG, &config) && (config >> 15) == 0) {
         if (millis() - start > 100) {
@@ -125,7 +140,54 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
       }
     }
   }
-
+  return this->read_conversion_(sensor);
+}
+void ADS1115Component::request_measurement_async(ADS1115Sensor *sensor) {
+  if (std::find(this->pending_.begin(), this->pending_.end(), sensor) != this->pending_.end())
+    return;
+  this->pending_.push_back(sensor);
+  // The channels share one converter, so their measurements run one after another
+  if (this->pending_.size() == 1)
+    this->start_next_measurement_();
+}
+void ADS1115Component::start_next_measurement_() {
+  while (!this->pending_.empty()) {
+    bool started;
+    if (this->configure_(this->pending_.front(), &started)) {
+      this->measurement_start_ = millis();
+      this->schedule_transaction(started ? 2 : 0, [this]() { this->poll_measurement_(); });
+      return;
+    }
+    this->pending_.erase(this->pending_.begin());
+  }
+}
+void ADS1115Component::poll_measurement_() {
+  ADS1115Sensor *sensor = this->pending_.front();
+  if (this->prev_config_ != this->config_for_(sensor)) {
+    // A synchronous sample() of another channel changed the configuration in the meantime
+    this->start_next_measurement_();
+    return;
+  }
+  float v = NAN;
+  uint16_t config;
+  if (!this->continuous_mode_ && this->read_byte_16(ADS1115_REGISTER_CONFIG, &config) && (config >> 15) == 0) {
+    if (millis() - this->measurement_start_ <= 100) {
+      this->schedule_transaction(1, [this]() { this->poll_measurement_(); });
+      return;
+    }
+    ESP_LOGW(TAG, "Reading ADS1115 timed out");
+    this->status_set_warning();
+  } else {
+    v = this->read_conversion_(sensor);
+  }
+  if (!std::isnan(v)) {
+    ESP_LOGD(TAG, "'%s': Got Voltage=%fV", sensor->get_name().c_str(), v);
+    sensor->publish_state(v);
+  }
+  this->pending_.erase(this->pending_.begin());
+  this->start_next_measurement_();
+}
+float ADS1115Component::read_conversion_(ADS1115Sensor *sensor) {
   uint16_t raw_conversion;
   if (!this->read_byte_16(ADS1115_REGISTER_CONVERSION, &raw_conversion)) {
     this->status_set_warning();
@@ -180,13 +242,7 @@ float ADS1115Component::request_measurement(ADS1115Sensor *sensor) {
 }
 
 float ADS1115Sensor::sample() { return this->parent_->request_measurement(this); }
-void ADS1115Sensor::update() {
-  float v = this->parent_->request_measurement(this);
-  if (!std::isnan(v)) {
-    ESP_LOGD(TAG, "'%s': Got Voltage=%fV", this->get_name().c_str(), v);
-    this->publish_state(v);
-  }
-}
+void ADS1115Sensor::update() { this->parent_->request_measurement_async(this); }
 
 }  // namespace ads1115
 }  // namespace esphome
@@ -47,11 +47,23 @@ class ADS1115Component : public Component, public i2c::I2CDevice {
   float get_setup_priority() const override { return setup_priority::DATA; }
   void set_continuous_mode(bool continuous_mode) { continuous_mode_ = continuous_mode; }
 
-  /// Helper method to request a measurement from a sensor.
+  /// Helper method to request a measurement from a sensor, waiting for the conversion.
   float request_measurement(ADS1115Sensor *sensor);
+  /// Measure in the background on the bus and publish the result to `sensor`.
+  void request_measurement_async(ADS1115Sensor *sensor);
 
  protected:
+  uint16_t config_for_(ADS1115Sensor *sensor) const;
+  /// Write the configuration of `sensor` if needed; `started` tells whether a new conversion has to be waited for.
+  bool configure_(ADS1115Sensor *sensor, bool *started);
+  float read_conversion_(ADS1115Sensor *sensor);
+  void start_next_measurement_();
+  void poll_measurement_();
+
   std::vector<ADS1115Sensor *> sensors_;
+  /// Sensors waiting for a background measurement, the front one is being measured.
+  std::vector<ADS1115Sensor *> pending_;
+  uint32_t measurement_start_{0};
   uint16_t prev_config_{0};
   bool continuous_mode_;
 };
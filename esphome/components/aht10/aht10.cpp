@@ -5,12 +5,10 @@
 //  - Unofficial Translated Datasheet (en):
 //  https://wiki.liutyi.info/download/attachments/30507639/Aosong_AHT10_en_draft_0c.pdf
 //
-// When configured for humidity, the log 'Components should block for at most 20-30ms in loop().' will be generated in
-// verbose mode. This is due to technical specs of the sensor and can not be avoided.
-//
 // According to the datasheet, the component is supposed to respond in more than 75ms. In fact, it can answer almost
 // immediately for temperature. But for humidity, it takes >90ms to get a valid data. From experience, we have best
 // results making successive requests; the current implementation makes 3 attempts with a delay of 30ms each time.
+// The attempts are scheduled on the bus, so the loop doesn't block while the sensor measures.
 
 #include "aht10.h"
 #include "esphome/core/log.h"
@@ -67,46 +65,46 @@ void AHT10Component::update() {
     this->status_set_warning();
     return;
   }
+  this->schedule_transaction(this->measure_delay_(), [this]() { this->read_data_(0); });
+}
+
+uint32_t AHT10Component::measure_delay_() const {
+  return this->humidity_sensor_ != nullptr ? AHT10_HUMIDITY_DELAY : AHT10_DEFAULT_DELAY;
+}
+
+void AHT10Component::read_data_(uint8_t attempt) {
+  ESP_LOGVV(TAG, "Attempt %u at %6" PRIu32, attempt, millis());
   uint8_t data[6];
-  uint8_t delay_ms = AHT10_DEFAULT_DELAY;
-  if (this->humidity_sensor_ != nullptr)
-    delay_ms = AHT10_HUMIDITY_DELAY;
-  bool success = false;
-  for (int i = 0; i < AHT10_ATTEMPTS; ++i) {
-    ESP_LOGVV(TAG, "Attempt %d at %6" PRIu32, i, millis());
-    delay(delay_ms);
-    if (this->read(data, 6) != i2c::ERROR_OK) {
-      ESP_LOGD(TAG, "Communication with AHT10 failed, waiting...");
-      continue;
-    }
+  if (this->read(data, 6) != i2c::ERROR_OK) {
+    ESP_LOGD(TAG, "Communication with AHT10 failed, waiting...");
+    this->retry_read_(attempt);
+    return;
+  }
 
-    if ((data[0] & 0x80) == 0x80) {  // Bit[7] = 0b1, device is busy
-      ESP_LOGD(TAG, "AHT10 is busy, waiting...");
-    } else if (data[1] == 0x0 && data[2] == 0x0 && (data[3] >> 4) == 0x0) {
-      // Unrealistic humidity (0x0)
-      if (this->humidity_sensor_ == nullptr) {
-        ESP_LOGVV(TAG, "ATH10 Unrealistic humidity (0x0), but humidity is not required");
-        break;
-      } else {
-        ESP_LOGD(TAG, "ATH10 Unrealistic humidity (0x0), retrying...");
-        if (!this->write_bytes(0, AHT10_MEASURE_CMD, sizeof(AHT10_MEASURE_CMD))) {
-          ESP_LOGE(TAG, "Communication with AHT10 failed!");
-          this->status_set_warning();
-          return;
-        }
-      }
-    } else {
-      // data is valid, we can break the loop
-      ESP_LOGVV(TAG, "Answer at %6" PRIu32, millis());
-      success = true;
-      break;
-    }
+  if ((data[0] & 0x80) == 0x80) {  // Bit[7] = 0b1, device is busy
+    ESP_LOGD(TAG, "AHT10 is busy, waiting...");
+    this->retry_read_(attempt);
+    return;
   }
-  if (!success || (data[0] & 0x80) == 0x80) {
-    ESP_LOGE(TAG, "Measurements reading timed-out!");
-    this->status_set_warning();
+  if (data[1] == 0x0 && data[2] == 0x0 && (data[3] >> 4) == 0x0) {
+    // Unrealistic humidity (0x0)
+    if (this->humidity_sensor_ == nullptr) {
+      ESP_LOGVV(TAG, "ATH10 Unrealistic humidity (0x0), but humidity is not required");
+      ESP_LOGE(TAG, "Measurements reading timed-out!");
+      this->status_set_warning();
+      return;
+    }
+    ESP_LOGD(TAG, "ATH10 Unrealistic humidity (0x0), retrying...");
+    if (!this->write_bytes(0, AHT10_MEASURE_CMD, sizeof(AHT10_MEASURE_CMD))) {
+      ESP_LOGE(TAG, "Communication with AHT10 failed!");
+      this->status_set_warning();
+      return;
+    }
+    this->retry_read_(attempt);
     return;
   }
+  // data is valid
+  ESP_LOGVV(TAG, "Answer at %6" PRIu32, millis());
 
   uint32_t raw_temperature = ((data[3] & 0x0F) << 16) | (data[4] << 8) | data[5];
   uint32_t raw_humidity = ((data[1] << 16) | (data[2] << 8) | data[3]) >> 4;
@@ -131,6 +129,15 @@ void AHT10Component::update() {
   this->status_clear_warning();
 }
 
+void AHT10Component::retry_read_(uint8_t attempt) {
+  if (attempt + 1 >= AHT10_ATTEMPTS) {
+    ESP_LOGE(TAG, "Measurements reading timed-out!");
+    this->status_set_warning();
+    return;
+  }
+  this->schedule_transaction(this->measure_delay_(), [this, attempt]() { this->read_data_(attempt + 1); });
+}
+
 float AHT10Component::get_setup_priority() const { return setup_priority::DATA; }
 
 void AHT10Component::dump_config() {
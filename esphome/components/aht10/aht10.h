@@ -18,6 +18,11 @@ class AHT10Component : public PollingComponent, public i2c::I2CDevice {
   void set_humidity_sensor(sensor::Sensor *humidity_sensor) { humidity_sensor_ = humidity_sensor; }
 
  protected:
+  uint32_t measure_delay_() const;
+  /// Read the measurement and publish it, or schedule another attempt if it isn't ready yet.
+  void read_data_(uint8_t attempt);
+  void retry_read_(uint8_t attempt);
+
   sensor::Sensor *temperature_sensor_{nullptr};
   sensor::Sensor *humidity_sensor_{nullptr};
 };
@@ -7,6 +7,7 @@ from esphome.components.image import CONF_USE_TRANSPARENCY
 import esphome.config_validation as cv
 import esphome.codegen as cg
 from esphome.const import (
+    CONF_DELTA,
     CONF_FILE,
     CONF_ID,
     CONF_RAW_DATA_ID,
@@ -27,6 +28,7 @@ CONF_LOOP = "loop"
 CONF_START_FRAME = "start_frame"
 CONF_END_FRAME = "end_frame"
 CONF_FRAME = "frame"
+CONF_FRAME_TABLE_ID = "frame_table_id"
 
 animation_ns = cg.esphome_ns.namespace("animation")
 
@@ -82,7 +84,9 @@ ANIMATION_SCHEMA = cv.Schema(
                     cv.Optional(CONF_REPEAT): cv.positive_int,
                 }
             ),
+            cv.Optional(CONF_DELTA, default=False): cv.boolean,
             cv.GenerateID(CONF_RAW_DATA_ID): cv.declare_id(cg.uint8),
+            cv.GenerateID(CONF_FRAME_TABLE_ID): cv.declare_id(cg.uint32),
         },
         validate_cross_dependencies,
     )
@@ -121,6 +125,54 @@ async def animation_action_to_code(config, action_id, template_arg, args):
     return var
 
 
+def delta_encode(data, frames, width, height, image_type):
+    """
+    Encode the full frames in data as the first frame followed by one patch per frame.
+    Each patch holds the bounding rectangle of the bytes that changed against the
+    previous frame. Returns the encoded data and the frame table with 5 entries per
+    frame: x, y, width, height (in pixels) and data offset of the patch.
+    """
+    if image_type in ["BINARY", "TRANSPARENT_BINARY"]:
+        stride = (width + 7) // 8
+        bytes_per_pixel = None
+    else:
+        bytes_per_pixel = len(data) // (width * height * frames)
+        stride = width * bytes_per_pixel
+    frame_size = stride * height
+
+    encoded = data[:frame_size]
+    table = [0, 0, width, height, 0]
+    for frame_index in range(1, frames):
+        prev = data[(frame_index - 1) * frame_size : frame_index * frame_size]
+        cur = data[frame_index * frame_size : (frame_index + 1) * frame_size]
+        col_min, col_max, row_min, row_max = stride, -1, height, -1
+        for y in range(height):
+            row = y * stride
+            changed = [c for c in range(stride) if prev[row + c] != cur[row + c]]
+            if changed:
+                col_min = min(col_min, changed[0])
+                col_max = max(col_max, changed[-1])
+                row_min = min(row_min, y)
+                row_max = max(row_max, y)
+        if row_max < 0:
+            table += [0, 0, 0, 0, len(encoded)]
+            continue
+
+        if bytes_per_pixel is None:
+            x = col_min * 8
+            w = min((col_max + 1) * 8, width) - x
+        else:
+            x = col_min // bytes_per_pixel
+            w = col_max // bytes_per_pixel + 1 - x
+            col_min = x * bytes_per_pixel
+            col_max = (x + w) * bytes_per_pixel - 1
+        table += [x, row_min, w, row_max - row_min + 1, len(encoded)]
+        for y in range(row_min, row_max + 1):
+            encoded += cur[y * stride + col_min : y * stride + col_max + 1]
+
+    return encoded, table
+
+
 async def to_code(config):
     from PIL import Image
 
@@ -278,6 +330,16 @@ async def to_code(config):
             f"Animation f{config[CONF_ID]} has not supported type {config[CONF_TYPE]}."
         )
 
+    if config[CONF_DELTA]:
+        full_size = len(data)
+        data, table = delta_encode(data, frames, width, height, config[CONF_TYPE])
+        _LOGGER.debug(
+            "Animation %s delta encoded from %d to %d bytes",
+            config[CONF_ID],
+            full_size,
+            len(data),
+        )
+
     rhs = [HexInt(x) for x in data]
     prog_arr = cg.progmem_array(config[CONF_RAW_DATA_ID], rhs)
     var = cg.new_Pvariable(
@@ -289,6 +351,9 @@ async def to_code(config):
         espImage.IMAGE_TYPE[config[CONF_TYPE]],
     )
     cg.add(var.set_transparency(transparent))
+    if config[CONF_DELTA]:
+        frame_table = cg.static_const_array(config[CONF_FRAME_TABLE_ID], table)
+        cg.add(var.set_delta_frames(frame_table))
     if loop_config := config.get(CONF_LOOP):
         start = loop_config[CONF_START_FRAME]
         end = loop_config.get(CONF_END_FRAME, frames)
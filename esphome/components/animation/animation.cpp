@@ -1,10 +1,14 @@
 #include "animation.h"
 
 #include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
 
 namespace esphome {
 namespace animation {
 
+static const char *const TAG = "animation";
+
 Animation::Animation(const uint8_t *data_start, int width, int height, uint32_t animation_frame_count,
                      image::ImageType type)
     : Image(data_start, width, height, type),
@@ -62,9 +66,80 @@ void Animation::set_frame(int frame) {
 }
 
 void Animation::update_data_start_() {
+  if (this->frame_table_ != nullptr) {
+    this->seek_delta_frame_(this->current_frame_);
+    return;
+  }
   const uint32_t image_size = image_type_to_width_stride(this->width_, this->type_) * this->height_;
   this->data_start_ = this->animation_data_start_ + image_size * this->current_frame_;
 }
 
+void Animation::seek_delta_frame_(int frame) {
+  const uint32_t image_size = image_type_to_width_stride(this->width_, this->type_) * this->height_;
+  if (this->canvas_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    this->canvas_ = allocator.allocate(image_size);
+    if (this->canvas_ == nullptr) {
+      ESP_LOGE(TAG, "Could not allocate buffer for animation frames!");
+      return;
+    }
+  }
+  if (frame == this->decoded_frame_)
+    return;
+
+  if (this->decoded_frame_ < 0 || frame < this->decoded_frame_) {
+    // Deltas only go forward, restart from the key frame
+    for (uint32_t i = 0; i < image_size; i++)
+      this->canvas_[i] = progmem_read_byte(this->animation_data_start_ + i);
+    this->decoded_frame_ = 0;
+    this->dirty_ = display::Rect(0, 0, this->width_, this->height_);
+  }
+  while (this->decoded_frame_ < frame)
+    this->apply_delta_frame_(++this->decoded_frame_);
+  this->data_start_ = this->canvas_;
+}
+
+void Animation::apply_delta_frame_(int frame) {
+  const uint32_t *entry = this->frame_table_ + frame * 5;
+  const int x = entry[0];
+  const int y = entry[1];
+  const int w = entry[2];
+  const int h = entry[3];
+  if (w == 0 || h == 0)
+    return;
+
+  // Patch rows are packed like the image itself; for binary images x and w are multiples of 8.
+  const uint8_t *src = this->animation_data_start_ + entry[4];
+  const uint32_t stride = image_type_to_width_stride(this->width_, this->type_);
+  const uint32_t row_bytes = image_type_to_width_stride(w, this->type_);
+  uint8_t *dst = this->canvas_ + y * stride + image_type_to_width_stride(x, this->type_);
+  for (int row = 0; row < h; row++) {
+    for (uint32_t i = 0; i < row_bytes; i++)
+      dst[i] = progmem_read_byte(src + i);
+    src += row_bytes;
+    dst += stride;
+  }
+  this->dirty_.extend(display::Rect(x, y, w, h));
+}
+
+void Animation::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  // With delta frames, only redraw the changed area when the display still holds the previous frame at the same place,
+  // which it doesn't after a page change. Transparent pixels are skipped while drawing, so stale content would remain
+  // under them.
+  bool partial = this->frame_table_ != nullptr && this->canvas_ != nullptr && !this->transparent_ &&
+                 display == this->last_display_ && x == this->last_x_ && y == this->last_y_ &&
+                 !display->is_full_redraw();
+  if (!partial) {
+    Image::draw(x, y, display, color_on, color_off);
+  } else if (this->dirty_.is_set()) {
+    this->draw_region_(x, y, display, color_on, color_off, this->dirty_.x, this->dirty_.y, this->dirty_.w,
+                       this->dirty_.h);
+  }
+  this->dirty_ = display::Rect();
+  this->last_display_ = display;
+  this->last_x_ = x;
+  this->last_y_ = y;
+}
+
 }  // namespace animation
 }  // namespace esphome
@@ -1,5 +1,6 @@
 #pragma once
 #include "esphome/components/image/image.h"
+#include "esphome/components/display/rect.h"
 
 #include "esphome/core/automation.h"
 
@@ -23,8 +24,29 @@ class Animation : public image::Image {
 
   void set_loop(uint32_t start_frame, uint32_t end_frame, int count);
 
+  /** Switch to delta encoded frame data.
+   *
+   * The data then holds the first frame in full, followed by one patch per frame covering the rectangle that
+   * changed against the previous frame. Each frame has 5 entries in `frame_table`: x, y, width and height of that
+   * rectangle in pixels and the offset of its patch in the data. Frames are decoded into a RAM canvas.
+   */
+  void set_delta_frames(const uint32_t *frame_table) { this->frame_table_ = frame_table; }
+
+  void draw(int x, int y, display::Display *display, Color color_on, Color color_off) override;
+
  protected:
   void update_data_start_();
+  void seek_delta_frame_(int frame);
+  void apply_delta_frame_(int frame);
+
+  const uint32_t *frame_table_{nullptr};
+  uint8_t *canvas_{nullptr};
+  int decoded_frame_{-1};
+  /// Area of the canvas that changed since it was last drawn.
+  display::Rect dirty_;
+  display::Display *last_display_{nullptr};
+  int last_x_{0};
+  int last_y_{0};
 
   const uint8_t *animation_data_start_;
   int current_frame_;
@@ -439,6 +439,25 @@ void DebugComponent::update() {
     this->psram_sensor_->publish_state(heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
   }
 #endif  // USE_ESP32
+
+#ifdef USE_DISPLAY
+  if (this->display_ != nullptr) {
+    if (this->display_render_time_sensor_ != nullptr)
+      this->display_render_time_sensor_->publish_state(this->display_->get_max_render_time_us() / 1000.0f);
+    if (this->display_flush_time_sensor_ != nullptr)
+      this->display_flush_time_sensor_->publish_state(this->display_->get_max_flush_time_us() / 1000.0f);
+    this->display_->reset_timing_stats();
+  }
+#endif  // USE_DISPLAY
+
+#ifdef USE_LIGHT
+  if (this->light_ != nullptr) {
+    if (this->light_frame_rate_sensor_ != nullptr)
+      this->light_frame_rate_sensor_->publish_state(this->light_->get_frame_rate());
+    if (this->light_dropped_frames_sensor_ != nullptr)
+      this->light_dropped_frames_sensor_->publish_state(this->light_->get_dropped_frames());
+  }
+#endif  // USE_LIGHT
 #endif  // USE_SENSOR
 }
 
@@ -11,6 +11,12 @@
 #ifdef USE_TEXT_SENSOR
 #include "esphome/components/text_sensor/text_sensor.h"
 #endif
+#ifdef USE_DISPLAY
+#include "esphome/components/display/display.h"
+#endif
+#ifdef USE_LIGHT
+#include "esphome/components/light/addressable_light.h"
+#endif
 
 namespace esphome {
 namespace debug {
@@ -36,6 +42,27 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   void set_psram_sensor(sensor::Sensor *psram_sensor) { this->psram_sensor_ = psram_sensor; }
 #endif  // USE_ESP32
+#ifdef USE_DISPLAY
+  void set_display(display::Display *display) { this->display_ = display; }
+  void set_display_render_time_sensor(sensor::Sensor *display_render_time_sensor) {
+    this->display_render_time_sensor_ = display_render_time_sensor;
+  }
+  void set_display_flush_time_sensor(sensor::Sensor *display_flush_time_sensor) {
+    this->display_flush_time_sensor_ = display_flush_time_sensor;
+  }
+#endif  // USE_DISPLAY
+#ifdef USE_LIGHT
+  void set_light(light::LightState *light_state) {
+    this->light_ = static_cast<light::AddressableLight *>(light_state->get_output());
+    this->light_->enable_frame_stats();
+  }
+  void set_light_frame_rate_sensor(sensor::Sensor *light_frame_rate_sensor) {
+    this->light_frame_rate_sensor_ = light_frame_rate_sensor;
+  }
+  void set_light_dropped_frames_sensor(sensor::Sensor *light_dropped_frames_sensor) {
+    this->light_dropped_frames_sensor_ = light_dropped_frames_sensor;
+  }
+#endif  // USE_LIGHT
 #endif  // USE_SENSOR
  protected:
   uint32_t free_heap_{};
@@ -53,6 +80,16 @@ class DebugComponent : public PollingComponent {
 #ifdef USE_ESP32
   sensor::Sensor *psram_sensor_{nullptr};
 #endif  // USE_ESP32
+#ifdef USE_DISPLAY
+  display::Display *display_{nullptr};
+  sensor::Sensor *display_render_time_sensor_{nullptr};
+  sensor::Sensor *display_flush_time_sensor_{nullptr};
+#endif  // USE_DISPLAY
+#ifdef USE_LIGHT
+  light::AddressableLight *light_{nullptr};
+  sensor::Sensor *light_frame_rate_sensor_{nullptr};
+  sensor::Sensor *light_dropped_frames_sensor_{nullptr};
+#endif  // USE_LIGHT
 #endif  // USE_SENSOR
 
 #ifdef USE_TEXT_SENSOR
@@ -1,12 +1,15 @@
 import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome.components import sensor
+from esphome.components.display import Display
+from esphome.components.light.types import AddressableLightState
 from esphome.const import (
     CONF_FREE,
     CONF_FRAGMENTATION,
     CONF_BLOCK,
     CONF_LOOP_TIME,
     ENTITY_CATEGORY_DIAGNOSTIC,
+    STATE_CLASS_TOTAL_INCREASING,
     UNIT_MILLISECOND,
     UNIT_PERCENT,
     UNIT_BYTES,
@@ -18,6 +21,31 @@ from . import CONF_DEBUG_ID, DebugComponent
 DEPENDENCIES = ["debug"]
 
 CONF_PSRAM = "psram"
+CONF_DISPLAY_ID = "display_id"
+CONF_DISPLAY_RENDER_TIME = "display_render_time"
+CONF_DISPLAY_FLUSH_TIME = "display_flush_time"
+CONF_LIGHT_ID = "light_id"
+CONF_LIGHT_FRAME_RATE = "light_frame_rate"
+CONF_LIGHT_DROPPED_FRAMES = "light_dropped_frames"
+
+
+def validate_display_timing(config):
+    has_sensor = CONF_DISPLAY_RENDER_TIME in config or CONF_DISPLAY_FLUSH_TIME in config
+    if has_sensor and CONF_DISPLAY_ID not in config:
+        raise cv.Invalid(
+            f"{CONF_DISPLAY_ID} is required for the display timing sensors"
+        )
+    return config
+
+
+def validate_light_frames(config):
+    has_sensor = (
+        CONF_LIGHT_FRAME_RATE in config or CONF_LIGHT_DROPPED_FRAMES in config
+    )
+    if has_sensor and CONF_LIGHT_ID not in config:
+        raise cv.Invalid(f"{CONF_LIGHT_ID} is required for the light frame sensors")
+    return config
+
 
 CONFIG_SCHEMA = {
     cv.GenerateID(CONF_DEBUG_ID): cv.use_id(DebugComponent),
@@ -59,8 +87,38 @@ CONFIG_SCHEMA = {
             entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
         ),
     ),
+    cv.Optional(CONF_DISPLAY_ID): cv.use_id(Display),
+    cv.Optional(CONF_DISPLAY_RENDER_TIME): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon=ICON_TIMER,
+        accuracy_decimals=1,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_DISPLAY_FLUSH_TIME): sensor.sensor_schema(
+        unit_of_measurement=UNIT_MILLISECOND,
+        icon=ICON_TIMER,
+        accuracy_decimals=1,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_LIGHT_ID): cv.use_id(AddressableLightState),
+    cv.Optional(CONF_LIGHT_FRAME_RATE): sensor.sensor_schema(
+        unit_of_measurement="fps",
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
+    cv.Optional(CONF_LIGHT_DROPPED_FRAMES): sensor.sensor_schema(
+        icon=ICON_COUNTER,
+        accuracy_decimals=0,
+        state_class=STATE_CLASS_TOTAL_INCREASING,
+        entity_category=ENTITY_CATEGORY_DIAGNOSTIC,
+    ),
 }
 
+CONFIG_SCHEMA = cv.All(
+    cv.Schema(CONFIG_SCHEMA), validate_display_timing, validate_light_frames
+)
+
 
 async def to_code(config):
     debug_component = await cg.get_variable(config[CONF_DEBUG_ID])
@@ -84,3 +142,27 @@ async def to_code(config):
     if psram_conf := config.get(CONF_PSRAM):
         sens = await sensor.new_sensor(psram_conf)
         cg.add(debug_component.set_psram_sensor(sens))
+
+    if display_id := config.get(CONF_DISPLAY_ID):
+        disp = await cg.get_variable(display_id)
+        cg.add(debug_component.set_display(disp))
+
+    if render_time_conf := config.get(CONF_DISPLAY_RENDER_TIME):
+        sens = await sensor.new_sensor(render_time_conf)
+        cg.add(debug_component.set_display_render_time_sensor(sens))
+
+    if flush_time_conf := config.get(CONF_DISPLAY_FLUSH_TIME):
+        sens = await sensor.new_sensor(flush_time_conf)
+        cg.add(debug_component.set_display_flush_time_sensor(sens))
+
+    if light_id := config.get(CONF_LIGHT_ID):
+        light_state = await cg.get_variable(light_id)
+        cg.add(debug_component.set_light(light_state))
+
+    if frame_rate_conf := config.get(CONF_LIGHT_FRAME_RATE):
+        sens = await sensor.new_sensor(frame_rate_conf)
+        cg.add(debug_component.set_light_frame_rate_sensor(sens))
+
+    if dropped_frames_conf := config.get(CONF_LIGHT_DROPPED_FRAMES):
+        sens = await sensor.new_sensor(dropped_frames_conf)
+        cg.add(debug_component.set_light_dropped_frames_sensor(sens))
@@ -2,16 +2,26 @@ import esphome.codegen as cg
 import esphome.config_validation as cv
 from esphome import core, automation
 from esphome.automation import maybe_simple_id
+from esphome.components import color
 from esphome.const import (
     CONF_AUTO_CLEAR_ENABLED,
+    CONF_BORDER,
+    CONF_COLOR,
+    CONF_FORMAT,
+    CONF_HEIGHT,
     CONF_ID,
     CONF_LAMBDA,
+    CONF_MAX_VALUE,
+    CONF_MIN_VALUE,
     CONF_PAGES,
     CONF_PAGE_ID,
     CONF_ROTATION,
     CONF_FROM,
+    CONF_SENSOR,
     CONF_TO,
     CONF_TRIGGER_ID,
+    CONF_TYPE,
+    CONF_WIDTH,
 )
 from esphome.core import coroutine_with_priority
 
@@ -38,6 +48,55 @@ DisplayOnPageChangeTrigger = display_ns.class_(
 )
 
 CONF_ON_PAGE_CHANGE = "on_page_change"
+CONF_WIDGETS = "widgets"
+CONF_X = "x"
+CONF_Y = "y"
+CONF_BACKGROUND_COLOR = "background_color"
+CONF_FONT = "font"
+CONF_ALIGN = "align"
+CONF_TEXT_SENSOR = "text_sensor"
+CONF_IMAGE = "image"
+CONF_COLOR_ON = "color_on"
+CONF_COLOR_OFF = "color_off"
+CONF_BAR = "bar"
+CONF_GRAPH = "graph"
+CONF_QR_CODE = "qr_code"
+CONF_SCALE = "scale"
+CONF_TEXT = "text"
+
+Widget = display_ns.class_("Widget")
+TextWidget = display_ns.class_("TextWidget", Widget)
+ImageWidget = display_ns.class_("ImageWidget", Widget)
+BarWidget = display_ns.class_("BarWidget", Widget)
+GraphWidget = display_ns.class_("GraphWidget", Widget)
+QrCodeWidget = display_ns.class_("QrCodeWidget", Widget)
+
+# Referenced by name only to avoid importing the components that depend on display
+Font = cg.esphome_ns.namespace("font").class_("Font")
+Image = cg.esphome_ns.namespace("image").class_("Image")
+Sensor = cg.esphome_ns.namespace("sensor").class_("Sensor")
+TextSensor = cg.esphome_ns.namespace("text_sensor").class_("TextSensor")
+Graph = cg.esphome_ns.namespace("graph").class_("Graph")
+QrCode = cg.esphome_ns.namespace("qr_code").class_("QrCode")
+
+TextAlign = display_ns.enum("TextAlign", is_class=True)
+TEXT_ALIGNS = {
+    name: getattr(TextAlign, name)
+    for name in [
+        "TOP_LEFT",
+        "TOP_CENTER",
+        "TOP_RIGHT",
+        "CENTER_LEFT",
+        "CENTER",
+        "CENTER_RIGHT",
+        "BASELINE_LEFT",
+        "BASELINE_CENTER",
+        "BASELINE_RIGHT",
+        "BOTTOM_LEFT",
+        "BOTTOM_CENTER",
+        "BOTTOM_RIGHT",
+    ]
+}
 
 DISPLAY_ROTATIONS = {
     0: display_ns.DISPLAY_ROTATION_0_DEGREES,
@@ -54,6 +113,83 @@ def validate_rotation(value):
     return cv.enum(DISPLAY_ROTATIONS, int=True)(value)
 
 
+def validate_text_widget(config):
+    if CONF_FORMAT not in config:
+        if CONF_SENSOR in config:
+            config[CONF_FORMAT] = "%.1f"
+        elif CONF_TEXT_SENSOR in config:
+            config[CONF_FORMAT] = "%s"
+        else:
+            raise cv.Invalid(
+                f"{CONF_FORMAT} is required without {CONF_SENSOR} or {CONF_TEXT_SENSOR}"
+            )
+    return config
+
+
+WIDGET_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_X): cv.int_,
+        cv.Required(CONF_Y): cv.int_,
+        cv.Required(CONF_WIDTH): cv.positive_not_null_int,
+        cv.Required(CONF_HEIGHT): cv.positive_not_null_int,
+        cv.Optional(CONF_PAGE_ID): cv.use_id(DisplayPage),
+        cv.Optional(CONF_BACKGROUND_COLOR): cv.use_id(color.ColorStruct),
+    }
+)
+
+WIDGET_SCHEMAS = cv.typed_schema(
+    {
+        CONF_TEXT: cv.All(
+            WIDGET_SCHEMA.extend(
+                {
+                    cv.GenerateID(): cv.declare_id(TextWidget),
+                    cv.Required(CONF_FONT): cv.use_id(Font),
+                    cv.Optional(CONF_FORMAT): cv.string,
+                    cv.Optional(CONF_COLOR): cv.use_id(color.ColorStruct),
+                    cv.Optional(CONF_ALIGN): cv.enum(TEXT_ALIGNS, upper=True),
+                    cv.Exclusive(CONF_SENSOR, "source"): cv.use_id(Sensor),
+                    cv.Exclusive(CONF_TEXT_SENSOR, "source"): cv.use_id(TextSensor),
+                }
+            ),
+            validate_text_widget,
+        ),
+        CONF_IMAGE: WIDGET_SCHEMA.extend(
+            {
+                cv.GenerateID(): cv.declare_id(ImageWidget),
+                cv.Required(CONF_IMAGE): cv.use_id(Image),
+                cv.Optional(CONF_COLOR_ON): cv.use_id(color.ColorStruct),
+                cv.Optional(CONF_COLOR_OFF): cv.use_id(color.ColorStruct),
+            }
+        ),
+        CONF_BAR: WIDGET_SCHEMA.extend(
+            {
+                cv.GenerateID(): cv.declare_id(BarWidget),
+                cv.Required(CONF_SENSOR): cv.use_id(Sensor),
+                cv.Optional(CONF_MIN_VALUE, default=0): cv.float_,
+                cv.Optional(CONF_MAX_VALUE, default=100): cv.float_,
+                cv.Optional(CONF_COLOR): cv.use_id(color.ColorStruct),
+                cv.Optional(CONF_BORDER, default=True): cv.boolean,
+            }
+        ),
+        CONF_GRAPH: WIDGET_SCHEMA.extend(
+            {
+                cv.GenerateID(): cv.declare_id(GraphWidget),
+                cv.Required(CONF_GRAPH): cv.use_id(Graph),
+                cv.Optional(CONF_COLOR): cv.use_id(color.ColorStruct),
+            }
+        ),
+        CONF_QR_CODE: WIDGET_SCHEMA.extend(
+            {
+                cv.GenerateID(): cv.declare_id(QrCodeWidget),
+                cv.Required(CONF_QR_CODE): cv.use_id(QrCode),
+                cv.Optional(CONF_COLOR): cv.use_id(color.ColorStruct),
+                cv.Optional(CONF_SCALE, default=1): cv.int_range(min=1),
+            }
+        ),
+    },
+    lower=True,
+)
+
 BASIC_DISPLAY_SCHEMA = cv.Schema(
     {
         cv.Optional(CONF_LAMBDA): cv.lambda_,
@@ -82,6 +218,7 @@ FULL_DISPLAY_SCHEMA = BASIC_DISPLAY_SCHEMA.extend(
             }
         ),
         cv.Optional(CONF_AUTO_CLEAR_ENABLED, default=True): cv.boolean,
+        cv.Optional(CONF_WIDGETS): cv.ensure_list(WIDGET_SCHEMAS),
     }
 )
 
@@ -115,8 +252,67 @@ async def setup_display_core_(var, config):
         )
 
 
+async def setup_widget_(display, config):
+    widget = cg.new_Pvariable(config[CONF_ID])
+    cg.add(
+        widget.set_bounds(
+            config[CONF_X], config[CONF_Y], config[CONF_WIDTH], config[CONF_HEIGHT]
+        )
+    )
+    if CONF_PAGE_ID in config:
+        page = await cg.get_variable(config[CONF_PAGE_ID])
+        cg.add(widget.set_page(page))
+    if CONF_BACKGROUND_COLOR in config:
+        background = await cg.get_variable(config[CONF_BACKGROUND_COLOR])
+        cg.add(widget.set_background_color(background))
+    if CONF_COLOR in config:
+        col = await cg.get_variable(config[CONF_COLOR])
+        cg.add(widget.set_color(col))
+
+    widget_type = config[CONF_TYPE]
+    if widget_type == CONF_TEXT:
+        font = await cg.get_variable(config[CONF_FONT])
+        cg.add(widget.set_font(font))
+        cg.add(widget.set_format(config[CONF_FORMAT]))
+        if CONF_ALIGN in config:
+            cg.add(widget.set_align(config[CONF_ALIGN]))
+        if CONF_SENSOR in config:
+            sens = await cg.get_variable(config[CONF_SENSOR])
+            cg.add(widget.set_sensor(sens))
+        if CONF_TEXT_SENSOR in config:
+            sens = await cg.get_variable(config[CONF_TEXT_SENSOR])
+            cg.add(widget.set_text_sensor(sens))
+    elif widget_type == CONF_IMAGE:
+        image = await cg.get_variable(config[CONF_IMAGE])
+        cg.add(widget.set_image(image))
+        if CONF_COLOR_ON in config:
+            col = await cg.get_variable(config[CONF_COLOR_ON])
+            cg.add(widget.set_color_on(col))
+        if CONF_COLOR_OFF in config:
+            col = await cg.get_variable(config[CONF_COLOR_OFF])
+            cg.add(widget.set_color_off(col))
+    elif widget_type == CONF_BAR:
+        sens = await cg.get_variable(config[CONF_SENSOR])
+        cg.add(widget.set_sensor(sens))
+        cg.add(widget.set_min_value(config[CONF_MIN_VALUE]))
+        cg.add(widget.set_max_value(config[CONF_MAX_VALUE]))
+        cg.add(widget.set_border(config[CONF_BORDER]))
+    elif widget_type == CONF_GRAPH:
+        graph = await cg.get_variable(config[CONF_GRAPH])
+        cg.add(widget.set_graph(graph))
+    elif widget_type == CONF_QR_CODE:
+        qr_code = await cg.get_variable(config[CONF_QR_CODE])
+        cg.add(widget.set_qr_code(qr_code))
+        cg.add(widget.set_scale(config[CONF_SCALE]))
+    cg.add(display.add_widget(widget))
+
+
 async def register_display(var, config):
     await setup_display_core_(var, config)
+    if CONF_WIDGETS in config:
+        cg.add_define("USE_DISPLAY_WIDGETS")
+        for conf in config[CONF_WIDGETS]:
+            await setup_widget_(var, conf)
 
 
 @automation.register_action(
@@ -190,3 +386,4 @@ async def display_is_displaying_page_to_code(config, condition_id, template_arg,
 @coroutine_with_priority(100.0)
 async def to_code(config):
     cg.add_global(display_ns.using)
+    cg.add_define("USE_DISPLAY")
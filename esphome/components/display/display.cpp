@@ -2,8 +2,13 @@
 
 #include <utility>
 
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#ifdef USE_DISPLAY_WIDGETS
+#include "widget.h"
+#endif
+
 namespace esphome {
 namespace display {
 
@@ -261,6 +266,15 @@ void Display::show_page(DisplayPage *page) {
 void Display::show_next_page() { this->page_->show_next(); }
 void Display::show_prev_page() { this->page_->show_prev(); }
 void Display::do_update_() {
+  const uint32_t start = micros();
+  // Without auto clear, the screen only still holds the last update if that showed the same page
+  this->full_redraw_ = this->auto_clear_enabled_ || !this->has_drawn_ || this->drawn_page_ != this->page_;
+#ifdef USE_DISPLAY_WIDGETS
+  // Widgets only redraw what changed, so they need a clean screen to start from
+  if (this->full_redraw_ && !this->auto_clear_enabled_ && !this->widgets_.empty()) {
+    this->clear();
+  }
+#endif
   if (this->auto_clear_enabled_) {
     this->clear();
   }
@@ -269,8 +283,44 @@ void Display::do_update_() {
   } else if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
+  this->damage_ = Rect(0, 0, this->get_width(), this->get_height());
+#ifdef USE_DISPLAY_WIDGETS
+  Rect widget_damage = this->draw_widgets_(this->full_redraw_);
+  // A writer lambda may draw anywhere, so only widgets alone narrow down what changed
+  if (!this->full_redraw_ && this->page_ == nullptr && !this->writer_.has_value())
+    this->damage_ = widget_damage;
+#endif
+  this->has_drawn_ = true;
+  this->drawn_page_ = this->page_;
   this->clear_clipping_();
+  this->max_render_time_us_ = std::max(this->max_render_time_us_, micros() - start);
+}
+void Display::record_flush_time_(uint32_t start_us) {
+  this->max_flush_time_us_ = std::max(this->max_flush_time_us_, micros() - start_us);
+}
+#ifdef USE_DISPLAY_WIDGETS
+Rect Display::draw_widgets_(bool full) {
+  Rect damage;
+  if (!this->widgets_drawn_) {
+    for (auto *widget : this->widgets_)
+      widget->setup();
+  }
+  for (auto *widget : this->widgets_) {
+    if (!widget->is_on_page(this->page_) || !(full || widget->is_dirty()))
+      continue;
+    Rect bounds = widget->get_bounds();
+    this->start_clipping(bounds);
+    if (!full)
+      this->filled_rectangle(bounds.x, bounds.y, bounds.w, bounds.h, widget->get_background_color());
+    widget->draw(*this);
+    this->end_clipping();
+    widget->clear_dirty();
+    damage.extend(bounds);
+  }
+  this->widgets_drawn_ = true;
+  return damage;
 }
+#endif
 void DisplayOnPageChangeTrigger::process(DisplayPage *from, DisplayPage *to) {
   if ((this->from_ == nullptr || this->from_ == from) && (this->to_ == nullptr || this->to_ == to))
     this->trigger(from, to);
@@ -134,6 +134,9 @@ enum DisplayRotation {
 
 class Display;
 class DisplayPage;
+#ifdef USE_DISPLAY_WIDGETS
+class Widget;
+#endif
 class DisplayOnPageChangeTrigger;
 
 using display_writer_t = std::function<void(Display &)>;
@@ -425,6 +428,34 @@ class Display {
 
   // Internal method to set display auto clearing.
   void set_auto_clear(bool auto_clear_enabled) { this->auto_clear_enabled_ = auto_clear_enabled; }
+  bool is_auto_clear_enabled() const { return this->auto_clear_enabled_; }
+  /** Whether the current update has to draw everything: auto clear is on, or the screen shows a different page.
+   *
+   * Only when this is false does the screen still hold what the last update drew, so drawables can update just what
+   * changed since.
+   */
+  bool is_full_redraw() const { return this->full_redraw_; }
+
+#ifdef USE_DISPLAY_WIDGETS
+  /// Internal method to add a retained-mode widget, drawn after the writer lambda on every update.
+  void add_widget(Widget *widget) { this->widgets_.push_back(widget); }
+#endif
+
+  /// Longest time spent in the writer lambda and widgets since the last reset_timing_stats(), in microseconds.
+  uint32_t get_max_render_time_us() const { return this->max_render_time_us_; }
+  /// Longest time spent sending the buffer to the display since the last reset_timing_stats(), in microseconds.
+  uint32_t get_max_flush_time_us() const { return this->max_flush_time_us_; }
+  void reset_timing_stats() {
+    this->max_render_time_us_ = 0;
+    this->max_flush_time_us_ = 0;
+  }
+  /** Area drawn by the last update, for drivers that can flush part of the screen.
+   *
+   * This is the whole screen, unless the display has no writer lambda and only some of its widgets were redrawn;
+   * then it's the union of their bounds, or not set at all if none were. Coordinates are rotated like the drawing
+   * methods.
+   */
+  Rect get_damage() const { return this->damage_; }
 
   DisplayRotation get_rotation() const { return this->rotation_; }
 
@@ -487,6 +518,12 @@ class Display {
 
   void do_update_();
   void clear_clipping_();
+  /// Record the duration of a buffer flush that started at `start_us` (from micros()), called by drivers.
+  void record_flush_time_(uint32_t start_us);
+#ifdef USE_DISPLAY_WIDGETS
+  /// Draw the widgets that need it and return the union of their bounds.
+  Rect draw_widgets_(bool full);
+#endif
 
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
@@ -495,6 +532,17 @@ class Display {
   std::vector<DisplayOnPageChangeTrigger *> on_page_change_triggers_;
   bool auto_clear_enabled_{true};
   std::vector<Rect> clipping_rectangle_;
+  uint32_t max_render_time_us_{0};
+  uint32_t max_flush_time_us_{0};
+  Rect damage_;
+  bool full_redraw_{true};
+  /// Page shown by the last update, and whether there was one.
+  const DisplayPage *drawn_page_{nullptr};
+  bool has_drawn_{false};
+#ifdef USE_DISPLAY_WIDGETS
+  std::vector<Widget *> widgets_;
+  bool widgets_drawn_{false};
+#endif
 };
 
 class DisplayPage {
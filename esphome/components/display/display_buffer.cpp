@@ -1,5 +1,6 @@
 #include "display_buffer.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "esphome/core/application.h"
@@ -68,5 +69,44 @@ void HOT DisplayBuffer::draw_pixel_at(int x, int y, Color color) {
   App.feed_wdt();
 }
 
+Rect DisplayBuffer::get_damage_internal_() {
+  Rect damage = this->get_damage();
+  if (!damage.is_set())
+    return damage;
+
+  const int width = this->get_width_internal();
+  const int height = this->get_height_internal();
+  int x = damage.x;
+  int y = damage.y;
+  int w = damage.w;
+  int h = damage.h;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_0_DEGREES:
+      break;
+    case DISPLAY_ROTATION_90_DEGREES:
+      x = width - (damage.y + damage.h);
+      y = damage.x;
+      std::swap(w, h);
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      x = width - (damage.x + damage.w);
+      y = height - (damage.y + damage.h);
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      x = damage.y;
+      y = height - (damage.x + damage.w);
+      std::swap(w, h);
+      break;
+  }
+
+  const int x1 = std::max(x, 0);
+  const int y1 = std::max(y, 0);
+  const int x2 = std::min(x + w, width);
+  const int y2 = std::min(y + h, height);
+  if (x1 >= x2 || y1 >= y2)
+    return {};
+  return Rect(x1, y1, x2 - x1, y2 - y1);
+}
+
 }  // namespace display
 }  // namespace esphome
@@ -29,6 +29,8 @@ class DisplayBuffer : public Display {
   virtual void draw_absolute_pixel_internal(int x, int y, Color color) = 0;
 
   void init_internal_(uint32_t buffer_length);
+  /// get_damage() in buffer coordinates, limited to the buffer.
+  Rect get_damage_internal_();
 
   uint8_t *buffer_{nullptr};
 };
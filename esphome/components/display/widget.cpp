@@ -0,0 +1,108 @@
+#include "widget.h"
+
+#ifdef USE_DISPLAY_WIDGETS
+
+#include <cmath>
+
+namespace esphome {
+namespace display {
+
+void TextWidget::setup() {
+#ifdef USE_SENSOR
+  if (this->sensor_ != nullptr)
+    this->sensor_->add_on_state_callback([this](float state) { this->mark_dirty(); });
+#endif
+#ifdef USE_TEXT_SENSOR
+  if (this->text_sensor_ != nullptr)
+    this->text_sensor_->add_on_state_callback([this](const std::string &state) { this->mark_dirty(); });
+#endif
+}
+
+void TextWidget::draw(Display &it) {
+  char buffer[64];
+  const char *text = this->format_.c_str();
+#ifdef USE_SENSOR
+  if (this->sensor_ != nullptr) {
+    snprintf(buffer, sizeof(buffer), this->format_.c_str(), this->sensor_->get_state());
+    text = buffer;
+  }
+#endif
+#ifdef USE_TEXT_SENSOR
+  if (this->text_sensor_ != nullptr) {
+    snprintf(buffer, sizeof(buffer), this->format_.c_str(), this->text_sensor_->get_state().c_str());
+    text = buffer;
+  }
+#endif
+
+  // Place the alignment anchor on the matching point of the widget bounds
+  auto align = static_cast<int>(this->align_);
+  int x = this->bounds_.x;
+  int y = this->bounds_.y;
+  if (align & static_cast<int>(TextAlign::CENTER_HORIZONTAL)) {
+    x += this->bounds_.w / 2;
+  } else if (align & static_cast<int>(TextAlign::RIGHT)) {
+    x += this->bounds_.w;
+  }
+  if (align & static_cast<int>(TextAlign::CENTER_VERTICAL)) {
+    y += this->bounds_.h / 2;
+  } else if (align & (static_cast<int>(TextAlign::BASELINE) | static_cast<int>(TextAlign::BOTTOM))) {
+    y += this->bounds_.h;
+  }
+  it.print(x, y, this->font_, this->color_, this->align_, text);
+}
+
+void ImageWidget::draw(Display &it) {
+  it.image(this->bounds_.x, this->bounds_.y, this->image_, this->color_on_, this->color_off_);
+}
+
+void BarWidget::setup() {
+#ifdef USE_SENSOR
+  if (this->sensor_ != nullptr)
+    this->sensor_->add_on_state_callback([this](float state) { this->mark_dirty(); });
+#endif
+}
+
+void BarWidget::draw(Display &it) {
+  float value = NAN;
+#ifdef USE_SENSOR
+  if (this->sensor_ != nullptr)
+    value = this->sensor_->get_state();
+#endif
+  if (this->border_)
+    it.rectangle(this->bounds_.x, this->bounds_.y, this->bounds_.w, this->bounds_.h, this->color_);
+  if (std::isnan(value) || this->max_value_ <= this->min_value_)
+    return;
+
+  float fraction = (value - this->min_value_) / (this->max_value_ - this->min_value_);
+  fraction = std::max(0.0f, std::min(1.0f, fraction));
+  int inset = this->border_ ? 2 : 0;
+  int width = (int) roundf((this->bounds_.w - 2 * inset) * fraction);
+  if (width > 0) {
+    it.filled_rectangle(this->bounds_.x + inset, this->bounds_.y + inset, width, this->bounds_.h - 2 * inset,
+                        this->color_);
+  }
+}
+
+#ifdef USE_GRAPH
+void GraphWidget::setup() {
+  for (auto *trace : this->graph_->get_traces())
+    trace->get_sensor()->add_on_state_callback([this](float state) { this->mark_dirty(); });
+}
+
+void GraphWidget::draw(Display &it) { it.graph(this->bounds_.x, this->bounds_.y, this->graph_, this->color_); }
+#endif
+
+#ifdef USE_QR_CODE
+void QrCodeWidget::setup() {
+  this->qr_code_->add_on_change_callback([this]() { this->mark_dirty(); });
+}
+
+void QrCodeWidget::draw(Display &it) {
+  it.qr_code(this->bounds_.x, this->bounds_.y, this->qr_code_, this->color_, this->scale_);
+}
+#endif
+
+}  // namespace display
+}  // namespace esphome
+
+#endif  // USE_DISPLAY_WIDGETS
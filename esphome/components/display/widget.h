@@ -0,0 +1,163 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_DISPLAY_WIDGETS
+
+#include <string>
+
+#include "display.h"
+#include "rect.h"
+
+#include "esphome/core/color.h"
+
+#ifdef USE_SENSOR
+#include "esphome/components/sensor/sensor.h"
+#endif
+#ifdef USE_TEXT_SENSOR
+#include "esphome/components/text_sensor/text_sensor.h"
+#endif
+
+namespace esphome {
+namespace display {
+
+/** A retained-mode element of a display.
+ *
+ * Widgets own a fixed rectangle of the screen. They are drawn in full whenever the display is redrawn
+ * from scratch; otherwise only widgets that have been marked dirty (usually because the value they are
+ * bound to changed) are cleared to their background and drawn again.
+ */
+class Widget {
+ public:
+  void set_bounds(int x, int y, int width, int height) { this->bounds_ = Rect(x, y, width, height); }
+  Rect get_bounds() const { return this->bounds_; }
+  void set_page(DisplayPage *page) { this->page_ = page; }
+  /// Whether this widget is shown while `page` is active.
+  bool is_on_page(const DisplayPage *page) const { return this->page_ == nullptr || this->page_ == page; }
+  void set_background_color(Color color) { this->background_color_ = color; }
+  Color get_background_color() const { return this->background_color_; }
+
+  /// Request the widget to be drawn again on the next display update.
+  void mark_dirty() { this->dirty_ = true; }
+  bool is_dirty() const { return this->dirty_; }
+  void clear_dirty() { this->dirty_ = false; }
+
+  /// Called once before the widget is drawn for the first time.
+  virtual void setup() {}
+  /// Draw the widget within its bounds.
+  virtual void draw(Display &it) = 0;
+
+ protected:
+  Rect bounds_;
+  DisplayPage *page_{nullptr};
+  Color background_color_{COLOR_OFF};
+  bool dirty_{true};
+};
+
+/// Widget that shows a static text, or the state of a sensor or text sensor formatted with printf.
+class TextWidget : public Widget {
+ public:
+  void set_font(BaseFont *font) { this->font_ = font; }
+  void set_color(Color color) { this->color_ = color; }
+  void set_align(TextAlign align) { this->align_ = align; }
+  void set_format(const std::string &format) { this->format_ = format; }
+#ifdef USE_SENSOR
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+#endif
+#ifdef USE_TEXT_SENSOR
+  void set_text_sensor(text_sensor::TextSensor *text_sensor) { this->text_sensor_ = text_sensor; }
+#endif
+
+  void setup() override;
+  void draw(Display &it) override;
+
+ protected:
+  BaseFont *font_{nullptr};
+  Color color_{COLOR_ON};
+  TextAlign align_{TextAlign::TOP_LEFT};
+  std::string format_;
+#ifdef USE_SENSOR
+  sensor::Sensor *sensor_{nullptr};
+#endif
+#ifdef USE_TEXT_SENSOR
+  text_sensor::TextSensor *text_sensor_{nullptr};
+#endif
+};
+
+/// Widget that shows an image; only redrawn when marked dirty.
+class ImageWidget : public Widget {
+ public:
+  void set_image(BaseImage *image) { this->image_ = image; }
+  void set_color_on(Color color) { this->color_on_ = color; }
+  void set_color_off(Color color) { this->color_off_ = color; }
+
+  void draw(Display &it) override;
+
+ protected:
+  BaseImage *image_{nullptr};
+  Color color_on_{COLOR_ON};
+  Color color_off_{COLOR_OFF};
+};
+
+/// Widget that fills a horizontal bar proportionally to the state of a sensor.
+class BarWidget : public Widget {
+ public:
+#ifdef USE_SENSOR
+  void set_sensor(sensor::Sensor *sensor) { this->sensor_ = sensor; }
+#endif
+  void set_min_value(float min_value) { this->min_value_ = min_value; }
+  void set_max_value(float max_value) { this->max_value_ = max_value; }
+  void set_color(Color color) { this->color_ = color; }
+  void set_border(bool border) { this->border_ = border; }
+
+  void setup() override;
+  void draw(Display &it) override;
+
+ protected:
+#ifdef USE_SENSOR
+  sensor::Sensor *sensor_{nullptr};
+#endif
+  float min_value_{0.0f};
+  float max_value_{100.0f};
+  Color color_{COLOR_ON};
+  bool border_{true};
+};
+
+#ifdef USE_GRAPH
+/// Widget that shows a graph and is redrawn whenever one of its traces gets a new value.
+class GraphWidget : public Widget {
+ public:
+  void set_graph(graph::Graph *graph) { this->graph_ = graph; }
+  void set_color(Color color) { this->color_ = color; }
+
+  void setup() override;
+  void draw(Display &it) override;
+
+ protected:
+  graph::Graph *graph_{nullptr};
+  Color color_{COLOR_ON};
+};
+#endif
+
+#ifdef USE_QR_CODE
+/// Widget that shows a QR code and is redrawn whenever its value changes.
+class QrCodeWidget : public Widget {
+ public:
+  void set_qr_code(qr_code::QrCode *qr_code) { this->qr_code_ = qr_code; }
+  void set_color(Color color) { this->color_ = color; }
+  void set_scale(int scale) { this->scale_ = scale; }
+
+  void setup() override;
+  void draw(Display &it) override;
+
+ protected:
+  qr_code::QrCode *qr_code_{nullptr};
+  Color color_{COLOR_ON};
+  int scale_{1};
+};
+#endif
+
+}  // namespace display
+}  // namespace esphome
+
+#endif  // USE_DISPLAY_WIDGETS
@@ -12,8 +12,11 @@ namespace dsmr {
 
 static const char *const TAG = "dsmr";
 
+// Long enough for the lines of most telegrams, a longer one grows the buffer once
+static const size_t INITIAL_LINE_CAPACITY = 128;
+
 void Dsmr::setup() {
-  this->telegram_ = new char[this->max_telegram_len_];  // NOLINT
+  this->line_.reserve(std::min(INITIAL_LINE_CAPACITY, this->max_telegram_len_));
   if (this->request_pin_ != nullptr) {
     this->request_pin_->setup();
   }
@@ -42,9 +45,9 @@ bool Dsmr::ready_to_request_data_() {
       this->start_requesting_data_();
     }
     if (!this->requesting_data_) {
-      while (this->available()) {
-        this->read();
-      }
+      const uint8_t *data;
+      while (size_t len = this->peek_span(&data))
+        this->consume(len);
     }
   }
   return this->requesting_data_;
@@ -62,7 +65,7 @@ bool Dsmr::receive_timeout_reached_() { return millis() - this->last_read_time_
 bool Dsmr::available_within_timeout_() {
   // Data are available for reading on the UART bus?
   // Then we can start reading right away.
-  if (this->available()) {
+  if (this->buffered()) {
     this->last_read_time_ = millis();
     return true;
   }
@@ -80,7 +83,7 @@ bool Dsmr::available_within_timeout_() {
   if (this->parent_->get_rx_buffer_size() < this->max_telegram_len_) {
     while (!this->receive_timeout_reached_()) {
       delay(5);
-      if (this->available()) {
+      if (this->buffered()) {
         this->last_read_time_ = millis();
         return true;
       }
@@ -117,158 +120,233 @@ void Dsmr::stop_requesting_data_() {
     } else {
       ESP_LOGV(TAG, "Stop reading data from P1 port");
     }
-    while (this->available()) {
-      this->read();
-    }
+    const uint8_t *data;
+    while (size_t len = this->peek_span(&data))
+      this->consume(len);
     this->requesting_data_ = false;
   }
 }
 
 void Dsmr::reset_telegram_() {
   this->header_found_ = false;
-  this->footer_found_ = false;
-  this->bytes_read_ = 0;
   this->crypt_bytes_read_ = 0;
   this->crypt_telegram_len_ = 0;
   this->last_read_time_ = 0;
+  this->reset_parser_();
+}
+
+void Dsmr::reset_parser_() {
+  this->footer_found_ = false;
+  this->line_.clear();
+  this->crc_ = 0;
+  this->line_complete_ = false;
+  this->identification_parsed_ = false;
+  this->parse_error_ = false;
+  this->data_ = MyData();
 }
 
 void Dsmr::receive_telegram_() {
   while (this->available_within_timeout_()) {
-    const char c = this->read();
-
-    // Find a new telegram header, i.e. forward slash.
-    if (c == '/') {
-      ESP_LOGV(TAG, "Header of telegram found");
-      this->reset_telegram_();
-      this->header_found_ = true;
-    }
-    if (!this->header_found_)
-      continue;
-
-    // Check for buffer overflow.
-    if (this->bytes_read_ >= this->max_telegram_len_) {
+    const uint8_t *data;
+    const size_t len = this->peek_span(&data);
+    for (size_t i = 0; i < len; i++) {
+      if (!this->process_char_(data[i]))
+        continue;
+      // Publish the sensor values. The bytes after the telegram are dropped with the rest of the receive buffer
+      // when reading stops.
+      this->consume(i + 1);
+      this->parse_telegram();
       this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: telegram larger than buffer (%d bytes)", this->max_telegram_len_);
       return;
     }
+    this->consume(len);
+  }
+}
 
-    // Some v2.2 or v3 meters will send a new value which starts with '('
-    // in a new line, while the value belongs to the previous ObisId. For
-    // proper parsing, remove these new line characters.
-    if (c == '(') {
-      while (true) {
-        auto previous_char = this->telegram_[this->bytes_read_ - 1];
-        if (previous_char == '\n' || previous_char == '\r') {
-          this->bytes_read_--;
-        } else {
-          break;
-        }
-      }
-    }
+bool Dsmr::process_char_(char c) {
+  // Find a new telegram header, i.e. forward slash.
+  if (c == '/') {
+    ESP_LOGV(TAG, "Header of telegram found");
+    this->reset_parser_();
+    this->header_found_ = true;
+  }
+  if (!this->header_found_)
+    return false;
 
-    // Store the byte in the buffer.
-    this->telegram_[this->bytes_read_] = c;
-    this->bytes_read_++;
+  if (this->footer_found_) {
+    // Check for the end of the hex checksum, i.e. a newline.
+    if (c == '\n')
+      return true;
+  } else {
+    // The checksum covers the telegram from the header up to and including the footer.
+    const uint8_t byte = c;
+    this->crc_ = crc16(&byte, 1, this->crc_, 0xa001);
+    if (c == '/')
+      return false;
+
+    // Parse a line once the next one starts: some v2.2 or v3 meters will send a new value which starts with '('
+    // in a new line, while the value belongs to the previous ObisId.
+    if (c == '\r' || c == '\n') {
+      this->line_complete_ = !this->line_.empty();
+      return false;
+    }
+    if (this->line_complete_ && c != '(')
+      this->parse_line_();
+    this->line_complete_ = false;
 
     // Check for a footer, i.e. exclamation mark, followed by a hex checksum.
     if (c == '!') {
       ESP_LOGV(TAG, "Footer of telegram found");
+      if (!this->line_.empty()) {
+        ESP_LOGE(TAG, "Last data line not CRLF terminated");
+        this->parse_error_ = true;
+        this->line_.clear();
+      }
       this->footer_found_ = true;
-      continue;
+      return false;
     }
-    // Check for the end of the hex checksum, i.e. a newline.
-    if (this->footer_found_ && c == '\n') {
-      // Parse the telegram and publish sensor values.
-      this->parse_telegram();
-      this->reset_telegram_();
-      return;
+  }
+
+  // Check for buffer overflow.
+  if (this->line_.size() >= this->max_telegram_len_) {
+    ESP_LOGE(TAG, "Error: telegram line larger than buffer (%d bytes)", this->max_telegram_len_);
+    this->reset_telegram_();
+    return false;
+  }
+
+  // Store the byte in the buffer, growing it no further than the configured length.
+  if (this->line_.size() == this->line_.capacity())
+    this->line_.reserve(std::min(this->line_.capacity() * 2, this->max_telegram_len_));
+  this->line_.push_back(c);
+  return false;
+}
+
+void Dsmr::parse_line_() {
+  const char *line = this->line_.data();
+  const char *end = line + this->line_.size();
+
+  ::dsmr::ParseResult<void> res;
+  if (!this->identification_parsed_) {
+    // The identification line is offered to the fields under the all-ones OBIS id, as the library parser does.
+    this->identification_parsed_ = true;
+    if (end - line < 4 || (line[3] != '5' && line[3] != '3')) {
+      res.fail(F("Invalid identification string"), line);
+    } else {
+      res = this->data_.parse_line(::dsmr::ObisId(255, 255, 255, 255, 255, 255), line, end);
     }
+  } else {
+    // Ignore unknown values.
+    res = ::dsmr::P1Parser::parse_line(&this->data_, line, end, false);
   }
+
+  if (res.err) {
+    // Parsing error, show it
+    auto err_str = res.fullError(line, end);
+    ESP_LOGE(TAG, "%s", err_str.c_str());
+    this->parse_error_ = true;
+  }
+  this->line_.clear();
 }
 
 void Dsmr::receive_encrypted_telegram_() {
   while (this->available_within_timeout_()) {
-    const char c = this->read();
-
-    // Find a new telegram start byte.
-    if (!this->header_found_) {
-      if ((uint8_t) c != 0xDB) {
-        continue;
+    const uint8_t *data;
+    const size_t len = this->peek_span(&data);
+    for (size_t i = 0; i < len; i++) {
+      const char c = data[i];
+
+      // Find a new telegram start byte.
+      if (!this->header_found_) {
+        if ((uint8_t) c != 0xDB) {
+          continue;
+        }
+        ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
+        this->reset_telegram_();
+        this->header_found_ = true;
       }
-      ESP_LOGV(TAG, "Start byte 0xDB of encrypted telegram found");
-      this->reset_telegram_();
-      this->header_found_ = true;
-    }
 
-    // Check for buffer overflow.
-    if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
-      this->reset_telegram_();
-      ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
-      return;
-    }
+      // Check for buffer overflow.
+      if (this->crypt_bytes_read_ >= this->max_telegram_len_) {
+        this->reset_telegram_();
+        ESP_LOGE(TAG, "Error: encrypted telegram larger than buffer (%d bytes)", this->max_telegram_len_);
+        this->consume(i + 1);
+        return;
+      }
 
-    // Store the byte in the buffer.
-    this->crypt_telegram_[this->crypt_bytes_read_] = c;
-    this->crypt_bytes_read_++;
+      // Store the byte in the buffer.
+      this->crypt_telegram_[this->crypt_bytes_read_] = c;
+      this->crypt_bytes_read_++;
 
-    // Read the length of the incoming encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
-      // Complete header + data bytes
-      this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
-      ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
-    }
+      // Read the length of the incoming encrypted telegram.
+      if (this->crypt_telegram_len_ == 0 && this->crypt_bytes_read_ > 20) {
+        // Complete header + data bytes
+        this->crypt_telegram_len_ = 13 + (this->crypt_telegram_[11] << 8 | this->crypt_telegram_[12]);
+        ESP_LOGV(TAG, "Encrypted telegram length: %d bytes", this->crypt_telegram_len_);
+      }
 
-    // Check for the end of the encrypted telegram.
-    if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
-      continue;
+      // Check for the end of the encrypted telegram.
+      if (this->crypt_telegram_len_ == 0 || this->crypt_bytes_read_ != this->crypt_telegram_len_) {
+        continue;
+      }
+      ESP_LOGV(TAG, "End of encrypted telegram found");
+      this->consume(i + 1);
+
+      // Decrypt the encrypted telegram in place.
+      GCM<AES128> *gcmaes128{new GCM<AES128>()};
+      gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
+      // the iv is 8 bytes of the system title + 4 bytes frame counter
+      // system title is at byte 2 and frame counter at byte 15
+      for (int j = 10; j < 14; j++)
+        this->crypt_telegram_[j] = this->crypt_telegram_[j + 4];
+      constexpr uint16_t iv_size{12};
+      gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
+      // the ciphertext start at byte 18
+      uint8_t *plain = &this->crypt_telegram_[18];
+      const size_t plain_len = this->crypt_bytes_read_ - 17;
+      gcmaes128->decrypt(plain, plain, plain_len);
+      delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
+
+      // Parse the decrypted telegram and publish sensor values.
+      const auto *start = static_cast<uint8_t *>(memchr(plain, '/', plain_len));
+      bool complete = false;
+      for (size_t j = start == nullptr ? plain_len : start - plain; j < plain_len && !complete; j++)
+        complete = this->process_char_(plain[j]);
+      if (complete) {
+        this->parse_telegram();
+      } else {
+        ESP_LOGE(TAG, "Decrypted telegram is incomplete");
+      }
+      this->reset_telegram_();
+      return;
     }
-    ESP_LOGV(TAG, "End of encrypted telegram found");
-
-    // Decrypt the encrypted telegram.
-    GCM<AES128> *gcmaes128{new GCM<AES128>()};
-    gcmaes128->setKey(this->decryption_key_.data(), gcmaes128->keySize());
-    // the iv is 8 bytes of the system title + 4 bytes frame counter
-    // system title is at byte 2 and frame counter at byte 15
-    for (int i = 10; i < 14; i++)
-      this->crypt_telegram_[i] = this->crypt_telegram_[i + 4];
-    constexpr uint16_t iv_size{12};
-    gcmaes128->setIV(&this->crypt_telegram_[2], iv_size);
-    gcmaes128->decrypt(reinterpret_cast<uint8_t *>(this->telegram_),
-                       // the ciphertext start at byte 18
-                       &this->crypt_telegram_[18],
-                       // cipher size
-                       this->crypt_bytes_read_ - 17);
-    delete gcmaes128;  // NOLINT(cppcoreguidelines-owning-memory)
-
-    this->bytes_read_ = strnlen(this->telegram_, this->max_telegram_len_);
-    ESP_LOGV(TAG, "Decrypted telegram size: %d bytes", this->bytes_read_);
-    ESP_LOGVV(TAG, "Decrypted telegram: %s", this->telegram_);
-
-    // Parse the decrypted telegram and publish sensor values.
-    this->parse_telegram();
-    this->reset_telegram_();
-    return;
+    this->consume(len);
   }
 }
 
 bool Dsmr::parse_telegram() {
-  MyData data;
   ESP_LOGV(TAG, "Trying to parse telegram");
   this->stop_requesting_data_();
-  ::dsmr::ParseResult<void> res =
-      ::dsmr::P1Parser::parse(&data, this->telegram_, this->bytes_read_, false,
-                              this->crc_check_);  // Parse telegram according to data definition. Ignore unknown values.
-  if (res.err) {
-    // Parsing error, show it
-    auto err_str = res.fullError(this->telegram_, this->telegram_ + this->bytes_read_);
-    ESP_LOGE(TAG, "%s", err_str.c_str());
-    return false;
-  } else {
-    this->status_clear_warning();
-    this->publish_sensors(data);
-    return true;
+  if (this->crc_check_) {
+    // The checksum after the footer was stored in the buffer.
+    optional<uint16_t> crc = {};
+    if (this->line_.size() >= 4)
+      crc = parse_hex<uint16_t>(this->line_.data(), 4);
+    if (!crc.has_value()) {
+      ESP_LOGE(TAG, "No checksum found");
+      return false;
+    }
+    if (*crc != this->crc_) {
+      ESP_LOGE(TAG, "Checksum mismatch");
+      return false;
+    }
   }
+  // Errors in the lines were logged when they were parsed.
+  if (this->parse_error_)
+    return false;
+
+  this->status_clear_warning();
+  this->publish_sensors(this->data_);
+  return true;
 }
 
 void Dsmr::dump_config() {
@@ -90,6 +90,15 @@ class Dsmr : public Component, public uart::UARTDevice {
   void receive_encrypted_telegram_();
   void reset_telegram_();
 
+  /// Feed one character of a plain telegram to the parser, returns true once the telegram is complete.
+  ///
+  /// Each OBIS line is parsed into data_ as soon as the next line starts and the checksum is accumulated
+  /// along the way, so only the current line is buffered. The values are published by parse_telegram()
+  /// when the checksum matches.
+  bool process_char_(char c);
+  void parse_line_();
+  void reset_parser_();
+
   /// Wait for UART data to become available within the read timeout.
   ///
   /// The smart meter might provide data in chunks, causing available() to
@@ -115,8 +124,9 @@ class Dsmr : public Component, public uart::UARTDevice {
   uint32_t receive_timeout_;
   bool receive_timeout_reached_();
   size_t max_telegram_len_;
-  char *telegram_{nullptr};
-  size_t bytes_read_{0};
+  /// Current line of the plain telegram, or its checksum once the footer is found. Grows with the longest line seen,
+  /// up to max_telegram_len_.
+  std::vector<char> line_;
   uint8_t *crypt_telegram_{nullptr};
   size_t crypt_telegram_len_{0};
   size_t crypt_bytes_read_{0};
@@ -124,6 +134,13 @@ class Dsmr : public Component, public uart::UARTDevice {
   bool header_found_{false};
   bool footer_found_{false};
 
+  // Incremental parser
+  MyData data_;
+  uint16_t crc_{0};
+  bool line_complete_{false};
+  bool identification_parsed_{false};
+  bool parse_error_{false};
+
 // Sensor member pointers
 #define DSMR_DECLARE_SENSOR(s) sensor::Sensor *s_##s##_{nullptr};
   DSMR_SENSOR_LIST(DSMR_DECLARE_SENSOR, )
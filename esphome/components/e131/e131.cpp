@@ -1,12 +1,19 @@
 #include "e131.h"
 #include "e131_addressable_light_effect.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 
+#include <algorithm>
+
 namespace esphome {
 namespace e131 {
 
 static const char *const TAG = "e131";
 static const int PORT = 5568;
+// Upper bound on datagrams read per loop, so a flood can't starve other components
+static const int MAX_PACKETS_PER_LOOP = 64;
+// Per E1.31, receivers fall back to unsynchronized output once sync packets stop arriving
+static const uint32_t SYNC_TIMEOUT_MS = 2500;
 
 E131Component::E131Component() {}
 
@@ -52,25 +59,77 @@ void E131Component::setup() {
 }
 
 void E131Component::loop() {
-  std::vector<uint8_t> payload;
-  E131Packet packet;
-  int universe = 0;
-  uint8_t buf[1460];
+  // Drain everything the socket has queued, keeping only the latest frame of each universe
+  for (int i = 0; i < MAX_PACKETS_PER_LOOP; i++) {
+    // The spare buffer is the one last released by a slot, which is empty the first time around
+    if (this->spare_buffer_.size() != E131_MAX_PACKET_SIZE)
+      this->spare_buffer_.resize(E131_MAX_PACKET_SIZE);
+
+    ssize_t len = this->socket_->read(this->spare_buffer_.data(), this->spare_buffer_.size());
+    if (len == -1) {
+      break;
+    }
+
+    const uint8_t *data = this->spare_buffer_.data();
+    E131Packet packet;
+    int universe = 0;
+    if (this->packet_(data, len, universe, packet)) {
+      this->receive_(universe, packet);
+    } else if (this->sync_packet_(data, len, universe)) {
+      this->synchronize_(universe);
+    } else {
+      ESP_LOGV(TAG, "Invalid packet received of size %zd.", len);
+    }
+  }
 
-  ssize_t len = this->socket_->read(buf, sizeof(buf));
-  if (len == -1) {
-    return;
+  // Without a recent sync packet, synchronized frames are applied as they come
+  bool synchronized = this->last_sync_ != 0 && millis() - this->last_sync_ < SYNC_TIMEOUT_MS;
+  for (auto &slot : this->universe_slots_) {
+    if (!slot.pending || (synchronized && slot.packet.sync_address != 0))
+      continue;
+    slot.pending = false;
+
+    if (!this->process_(slot.universe, slot.packet)) {
+      ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", slot.universe, slot.packet.count);
+    }
   }
-  payload.resize(len);
-  memmove(&payload[0], buf, len);
+}
 
-  if (!this->packet_(payload, universe, packet)) {
-    ESP_LOGV(TAG, "Invalid packet received of size %zu.", payload.size());
+void E131Component::receive_(int universe, const E131Packet &packet) {
+  auto it = std::lower_bound(this->universe_slots_.begin(), this->universe_slots_.end(), universe,
+                             [](const E131UniverseSlot &slot, int universe) { return slot.universe < universe; });
+  if (it == this->universe_slots_.end() || it->universe != universe) {
+    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
     return;
   }
 
-  if (!this->process_(universe, packet)) {
-    ESP_LOGV(TAG, "Ignored packet for %d universe of size %d.", universe, packet.count);
+  // `packet` points into the spare buffer; hand that buffer to the slot instead of copying the values
+  auto &slot = *it;
+  std::swap(slot.buffer, this->spare_buffer_);
+  slot.packet = packet;
+  slot.pending = true;
+}
+
+void E131Component::synchronize_(int sync_universe) {
+  this->last_sync_ = std::max<uint32_t>(millis(), 1);
+
+  for (auto &slot : this->universe_slots_) {
+    if (!slot.pending || slot.packet.sync_address != sync_universe)
+      continue;
+    slot.pending = false;
+    this->process_(slot.universe, slot.packet);
+  }
+}
+
+void E131Component::rebuild_universe_index_() {
+  // Universe ranges change only when effects start or stop, so pending frames can be dropped.
+  // The consumer map is sorted, so the slots come out sorted for the lookup in receive_().
+  this->universe_slots_.clear();
+  for (auto universe : this->universe_consumers_) {
+    if (!universe.second)
+      continue;
+    this->universe_slots_.emplace_back();
+    this->universe_slots_.back().universe = universe.first;
   }
 }
 
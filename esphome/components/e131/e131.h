@@ -17,10 +17,24 @@ class E131AddressableLightEffect;
 enum E131ListenMethod { E131_MULTICAST, E131_UNICAST };
 
 const int E131_MAX_PROPERTY_VALUES_COUNT = 513;
+// Largest datagram we accept (a full data packet with 513 property values)
+const size_t E131_MAX_PACKET_SIZE = 638;
 
 struct E131Packet {
   uint16_t count;
-  uint8_t values[E131_MAX_PROPERTY_VALUES_COUNT];
+  // Synchronization universe from the frame layer, 0 if the frame is to be applied immediately
+  uint16_t sync_address;
+  // Points into the received datagram; `values[0]` is the DMX start code
+  const uint8_t *values;
+};
+
+// Latest frame received for a universe somebody listens to
+struct E131UniverseSlot {
+  int universe;
+  // Receive buffer holding the datagram `packet` points into, swapped with the spare buffer on receive
+  std::vector<uint8_t> buffer;
+  E131Packet packet;
+  bool pending{false};
 };
 
 class E131Component : public esphome::Component {
@@ -38,8 +52,12 @@ class E131Component : public esphome::Component {
   void set_method(E131ListenMethod listen_method) { this->listen_method_ = listen_method; }
 
  protected:
-  bool packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet);
+  bool packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet);
+  bool sync_packet_(const uint8_t *data, size_t len, int &sync_universe);
   bool process_(int universe, const E131Packet &packet);
+  void receive_(int universe, const E131Packet &packet);
+  void synchronize_(int sync_universe);
+  void rebuild_universe_index_();
   bool join_igmp_groups_();
   void join_(int universe);
   void leave_(int universe);
@@ -48,7 +66,10 @@ class E131Component : public esphome::Component {
   std::unique_ptr<socket::Socket> socket_;
   std::set<E131AddressableLightEffect *> light_effects_;
   std::map<int, int> universe_consumers_;
-  std::map<int, E131Packet> universe_packets_;
+  // Joined universes, sorted by universe number
+  std::vector<E131UniverseSlot> universe_slots_;
+  std::vector<uint8_t> spare_buffer_;
+  uint32_t last_sync_{0};
 };
 
 }  // namespace e131
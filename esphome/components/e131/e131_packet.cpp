@@ -1,13 +1,19 @@
+#include <cstddef>
 #include <cstring>
 #include "e131.h"
-#include "esphome/components/network/ip_address.h"
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 
+#ifdef USE_HOST
+#include <cerrno>
+#else
+#include "esphome/components/network/ip_address.h"
+
 #include <lwip/igmp.h>
 #include <lwip/init.h>
 #include <lwip/ip4_addr.h>
 #include <lwip/ip_addr.h>
+#endif
 
 namespace esphome {
 namespace e131 {
@@ -16,7 +22,9 @@ static const char *const TAG = "e131";
 
 static const uint8_t ACN_ID[12] = {0x41, 0x53, 0x43, 0x2d, 0x45, 0x31, 0x2e, 0x31, 0x37, 0x00, 0x00, 0x00};
 static const uint32_t VECTOR_ROOT = 4;
+static const uint32_t VECTOR_ROOT_EXTENDED = 8;
 static const uint32_t VECTOR_FRAME = 2;
+static const uint32_t VECTOR_FRAME_SYNCHRONIZATION = 1;
 static const uint8_t VECTOR_DMP = 2;
 
 // E1.31 Packet Structure
@@ -35,7 +43,7 @@ union E131RawPacket {
     uint32_t frame_vector;
     uint8_t source_name[64];
     uint8_t priority;
-    uint16_t reserved;
+    uint16_t sync_address;
     uint8_t sequence_number;
     uint8_t options;
     uint16_t universe;
@@ -50,13 +58,41 @@ union E131RawPacket {
     uint8_t property_values[E131_MAX_PROPERTY_VALUES_COUNT];
   } __attribute__((packed));
 
-  uint8_t raw[638];
+  uint8_t raw[E131_MAX_PACKET_SIZE];
 };
 
+// E1.31 Synchronization Packet Structure
+struct E131RawSyncPacket {
+  // Root Layer
+  uint16_t preamble_size;
+  uint16_t postamble_size;
+  uint8_t acn_id[12];
+  uint16_t root_flength;
+  uint32_t root_vector;
+  uint8_t cid[16];
+
+  // Frame Layer
+  uint16_t frame_flength;
+  uint32_t frame_vector;
+  uint8_t sequence_number;
+  uint16_t sync_address;
+  uint16_t reserved;
+} __attribute__((packed));
+
 // We need to have at least one `1` value
 // Get the offset of `property_values[1]`
 const size_t E131_MIN_PACKET_SIZE = reinterpret_cast<size_t>(&((E131RawPacket *) nullptr)->property_values[1]);
 
+#ifdef USE_HOST
+// Without lwIP the multicast groups are joined on the socket itself
+static int multicast_membership(socket::Socket *socket, int option, int universe) {
+  struct ip_mreq mreq {};
+  mreq.imr_multiaddr.s_addr = htonl(0xEFFF0000 | (universe & 0xffff));
+  mreq.imr_interface.s_addr = htonl(INADDR_ANY);
+  return socket->setsockopt(IPPROTO_IP, option, &mreq, sizeof(mreq));
+}
+#endif
+
 bool E131Component::join_igmp_groups_() {
   if (listen_method_ != E131_MULTICAST)
     return false;
@@ -67,10 +103,17 @@ bool E131Component::join_igmp_groups_() {
     if (!universe.second)
       continue;
 
+#ifdef USE_HOST
+    // Groups joined before are refused with EADDRINUSE
+    auto err = multicast_membership(this->socket_.get(), IP_ADD_MEMBERSHIP, universe.first);
+    if (err != 0 && errno == EADDRINUSE)
+      err = 0;
+#else
     ip4_addr_t multicast_addr =
         network::IPAddress(239, 255, ((universe.first >> 8) & 0xff), ((universe.first >> 0) & 0xff));
 
     auto err = igmp_joingroup(IP4_ADDR_ANY4, &multicast_addr);
+#endif
 
     if (err) {
       ESP_LOGW(TAG, "IGMP join for %d universe of E1.31 failed. Multicast might not work.", universe.first);
@@ -88,6 +131,8 @@ void E131Component::join_(int universe) {
     return;  // we already joined before
   }
 
+  this->rebuild_universe_index_();
+
   if (join_igmp_groups_()) {
     ESP_LOGD(TAG, "Joined %d universe for E1.31.", universe);
   }
@@ -100,20 +145,27 @@ void E131Component::leave_(int universe) {
     return;  // we have other consumers of the given universe
   }
 
+  this->rebuild_universe_index_();
+
   if (listen_method_ == E131_MULTICAST) {
+#ifdef USE_HOST
+    if (this->socket_ != nullptr)
+      multicast_membership(this->socket_.get(), IP_DROP_MEMBERSHIP, universe);
+#else
     ip4_addr_t multicast_addr = network::IPAddress(239, 255, ((universe >> 8) & 0xff), ((universe >> 0) & 0xff));
 
     igmp_leavegroup(IP4_ADDR_ANY4, &multicast_addr);
+#endif
   }
 
   ESP_LOGD(TAG, "Left %d universe for E1.31.", universe);
 }
 
-bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E131Packet &packet) {
-  if (data.size() < E131_MIN_PACKET_SIZE)
+bool E131Component::packet_(const uint8_t *data, size_t len, int &universe, E131Packet &packet) {
+  if (len < E131_MIN_PACKET_SIZE)
     return false;
 
-  auto *sbuff = reinterpret_cast<const E131RawPacket *>(&data[0]);
+  auto *sbuff = reinterpret_cast<const E131RawPacket *>(data);
 
   if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
     return false;
@@ -128,10 +180,28 @@ bool E131Component::packet_(const std::vector<uint8_t> &data, int &universe, E13
 
   universe = htons(sbuff->universe);
   packet.count = htons(sbuff->property_value_count);
-  if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT)
+  if (packet.count > E131_MAX_PROPERTY_VALUES_COUNT || packet.count > len - offsetof(E131RawPacket, property_values))
+    return false;
+
+  packet.sync_address = htons(sbuff->sync_address);
+  packet.values = sbuff->property_values;
+  return true;
+}
+
+bool E131Component::sync_packet_(const uint8_t *data, size_t len, int &sync_universe) {
+  if (len < sizeof(E131RawSyncPacket))
+    return false;
+
+  auto *sbuff = reinterpret_cast<const E131RawSyncPacket *>(data);
+
+  if (memcmp(sbuff->acn_id, ACN_ID, sizeof(sbuff->acn_id)) != 0)
+    return false;
+  if (htonl(sbuff->root_vector) != VECTOR_ROOT_EXTENDED)
+    return false;
+  if (htonl(sbuff->frame_vector) != VECTOR_FRAME_SYNCHRONIZATION)
     return false;
 
-  memcpy(packet.values, sbuff->property_values, packet.count);
+  sync_universe = htons(sbuff->sync_address);
   return true;
 }
 
@@ -8,12 +8,31 @@
 
 #include <esp_attr.h>
 
+#include <algorithm>
+
 namespace esphome {
 namespace esp32_rmt_led_strip {
 
 static const char *const TAG = "esp32_rmt_led_strip";
 
 static const uint8_t RMT_CLK_DIV = 2;
+// A frame still being sent after this long means the RMT channel is stuck
+static const uint32_t TX_TIMEOUT_US = 1000000;
+
+// Called by the RMT driver whenever its memory block needs more items, the context is the encoder
+static void IRAM_ATTR translate_to_rmt(const void *src, rmt_item32_t *dest, size_t src_size, size_t wanted_num,
+                                       size_t *translated_size, size_t *item_num) {
+  void *context = nullptr;
+  if (src == nullptr || dest == nullptr || rmt_translator_get_context(item_num, &context) != ESP_OK) {
+    *translated_size = 0;
+    *item_num = 0;
+    return;
+  }
+  size_t len = std::min(src_size, wanted_num / 8);
+  static_cast<const RMTEncoder *>(context)->encode(static_cast<const uint8_t *>(src), len, dest);
+  *translated_size = len;
+  *item_num = len * 8;
+}
 
 void ESP32RMTLEDStripLightOutput::setup() {
   ESP_LOGCONFIG(TAG, "Setting up ESP32 LED Strip...");
@@ -35,8 +54,17 @@ void ESP32RMTLEDStripLightOutput::setup() {
     return;
   }
 
-  ExternalRAMAllocator<rmt_item32_t> rmt_allocator(ExternalRAMAllocator<rmt_item32_t>::ALLOW_FAILURE);
-  this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8);  // 8 bits per byte, 1 rmt_item32_t per bit
+  if (this->use_rmt_translator_) {
+    this->tx_buf_ = allocator.allocate(buffer_size);
+    if (this->tx_buf_ == nullptr) {
+      ESP_LOGE(TAG, "Cannot allocate transmit buffer!");
+      this->mark_failed();
+      return;
+    }
+  } else {
+    ExternalRAMAllocator<rmt_item32_t> rmt_allocator(ExternalRAMAllocator<rmt_item32_t>::ALLOW_FAILURE);
+    this->rmt_buf_ = rmt_allocator.allocate(buffer_size * 8);  // 8 bits per byte, 1 rmt_item32_t per bit
+  }
 
   rmt_config_t config;
   memset(&config, 0, sizeof(config));
@@ -61,6 +89,12 @@ void ESP32RMTLEDStripLightOutput::setup() {
     this->mark_failed();
     return;
   }
+  if (this->use_rmt_translator_ && (rmt_translator_init(config.channel, translate_to_rmt) != ESP_OK ||
+                                    rmt_translator_set_context(config.channel, &this->encoder_) != ESP_OK)) {
+    ESP_LOGE(TAG, "Cannot install RMT translator!");
+    this->mark_failed();
+    return;
+  }
 }
 
 void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high,
@@ -68,18 +102,27 @@ void ESP32RMTLEDStripLightOutput::set_led_params(uint32_t bit0_high, uint32_t bi
   float ratio = (float) APB_CLK_FREQ / RMT_CLK_DIV / 1e09f;
 
   // 0-bit
-  this->bit0_.duration0 = (uint32_t) (ratio * bit0_high);
-  this->bit0_.level0 = 1;
-  this->bit0_.duration1 = (uint32_t) (ratio * bit0_low);
-  this->bit0_.level1 = 0;
+  rmt_item32_t bit0;
+  bit0.duration0 = (uint32_t) (ratio * bit0_high);
+  bit0.level0 = 1;
+  bit0.duration1 = (uint32_t) (ratio * bit0_low);
+  bit0.level1 = 0;
   // 1-bit
-  this->bit1_.duration0 = (uint32_t) (ratio * bit1_high);
-  this->bit1_.level0 = 1;
-  this->bit1_.duration1 = (uint32_t) (ratio * bit1_low);
-  this->bit1_.level1 = 0;
+  rmt_item32_t bit1;
+  bit1.duration0 = (uint32_t) (ratio * bit1_high);
+  bit1.level0 = 1;
+  bit1.duration1 = (uint32_t) (ratio * bit1_low);
+  bit1.level1 = 0;
+
+  this->encoder_.set_symbols(bit0, bit1);
 }
 
 void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
+  if (this->frame_group_ != nullptr) {
+    this->request_group_frame_();
+    return;
+  }
+
   // protect from refreshing too often
   uint32_t now = micros();
   if (*this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < *this->max_refresh_rate_) {
@@ -87,45 +130,64 @@ void ESP32RMTLEDStripLightOutput::write_state(light::LightState *state) {
     this->schedule_show();
     return;
   }
-  this->last_refresh_ = now;
-  this->mark_shown_();
 
-  ESP_LOGVV(TAG, "Writing RGB values to bus...");
+  // Don't block the main loop while the previous frame is still being sent; the newest data goes out next time
+  if (this->is_sending_()) {
+    this->record_frame_deferred_();
+    return;
+  }
+
+  this->send_frame_();
+}
 
-  if (rmt_wait_tx_done(this->channel_, pdMS_TO_TICKS(1000)) != ESP_OK) {
+bool ESP32RMTLEDStripLightOutput::is_sending_() {
+  if (rmt_wait_tx_done(this->channel_, 0) == ESP_OK)
+    return false;
+  if (micros() - this->last_refresh_ > TX_TIMEOUT_US) {
     ESP_LOGE(TAG, "RMT TX timeout");
     this->status_set_warning();
-    return;
   }
-  delayMicroseconds(50);
+  return true;
+}
 
-  size_t buffer_size = this->get_buffer_size_();
+uint32_t ESP32RMTLEDStripLightOutput::get_frame_checksum_() {
+  return frame_checksum_(this->buf_, this->get_buffer_size_());
+}
 
-  size_t size = 0;
-  size_t len = 0;
-  uint8_t *psrc = this->buf_;
-  rmt_item32_t *pdest = this->rmt_buf_;
-  while (size < buffer_size) {
-    uint8_t b = *psrc;
-    for (int i = 0; i < 8; i++) {
-      pdest->val = b & (1 << (7 - i)) ? this->bit1_.val : this->bit0_.val;
-      pdest++;
-      len++;
-    }
-    size++;
-    psrc++;
+void ESP32RMTLEDStripLightOutput::send_frame_() {
+  size_t buffer_size = this->get_buffer_size_();
+  uint32_t checksum = this->get_frame_checksum_();
+  if (this->is_frame_unchanged_(checksum)) {
+    ESP_LOGVV(TAG, "LED values unchanged, skipping frame");
+    this->record_frame_skipped_();
+    return;
   }
 
-  if (rmt_write_items(this->channel_, this->rmt_buf_, len, false) != ESP_OK) {
+  this->last_refresh_ = micros();
+  this->mark_shown_();
+
+  ESP_LOGVV(TAG, "Writing RGB values to bus...");
+  delayMicroseconds(50);
+
+  esp_err_t err;
+  if (this->use_rmt_translator_) {
+    // The translator reads from this copy while sending, so effects can keep changing buf_ in the meantime
+    memcpy(this->tx_buf_, this->buf_, buffer_size);
+    err = rmt_write_sample(this->channel_, this->tx_buf_, buffer_size, false);
+  } else {
+    this->encoder_.encode(this->buf_, buffer_size, this->rmt_buf_);
+    err = rmt_write_items(this->channel_, this->rmt_buf_, buffer_size * 8, false);
+  }
+  if (err != ESP_OK) {
     ESP_LOGE(TAG, "RMT TX error");
     this->status_set_warning();
     return;
   }
+  this->record_frame_shown_(checksum);
   this->status_clear_warning();
 }
 
-light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0;
+void ESP32RMTLEDStripLightOutput::get_rgb_offsets_(int32_t &r, int32_t &g, int32_t &b) const {
   switch (this->rgb_order_) {
     case ORDER_RGB:
       r = 0;
@@ -158,6 +220,11 @@ light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index
       b = 0;
       break;
   }
+}
+
+light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index) const {
+  int32_t r = 0, g = 0, b = 0;
+  this->get_rgb_offsets_(r, g, b);
   uint8_t multiplier = this->is_rgbw_ ? 4 : 3;
   return {this->buf_ + (index * multiplier) + r,
           this->buf_ + (index * multiplier) + g,
@@ -167,6 +234,14 @@ light::ESPColorView ESP32RMTLEDStripLightOutput::get_view_internal(int32_t index
           &this->correction_};
 }
 
+light::ESPColorSpan ESP32RMTLEDStripLightOutput::get_span_internal() const {
+  int32_t r = 0, g = 0, b = 0;
+  this->get_rgb_offsets_(r, g, b);
+  if (this->is_rgbw_)
+    return {this->buf_, this->size(), 4, (uint8_t) r, (uint8_t) g, (uint8_t) b, 3};
+  return {this->buf_, this->size(), 3, (uint8_t) r, (uint8_t) g, (uint8_t) b};
+}
+
 void ESP32RMTLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "ESP32 RMT LED Strip:");
   ESP_LOGCONFIG(TAG, "  Pin: %u", this->pin_);
@@ -198,6 +273,7 @@ void ESP32RMTLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "  RGB Order: %s", rgb_order);
   ESP_LOGCONFIG(TAG, "  Max refresh rate: %" PRIu32, *this->max_refresh_rate_);
   ESP_LOGCONFIG(TAG, "  Number of LEDs: %u", this->num_leds_);
+  ESP_LOGCONFIG(TAG, "  RMT translator: %s", YESNO(this->use_rmt_translator_));
 }
 
 float ESP32RMTLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
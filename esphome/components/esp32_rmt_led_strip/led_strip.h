@@ -3,6 +3,7 @@
 #ifdef USE_ESP32
 
 #include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/led_encoding.h"
 #include "esphome/components/light/light_output.h"
 #include "esphome/core/color.h"
 #include "esphome/core/component.h"
@@ -15,6 +16,8 @@
 namespace esphome {
 namespace esp32_rmt_led_strip {
 
+using RMTEncoder = light::LEDBitEncoder<rmt_item32_t>;
+
 enum RGBOrder : uint8_t {
   ORDER_RGB,
   ORDER_RBG,
@@ -49,6 +52,9 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
   void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
 
   void set_led_params(uint32_t bit0_high, uint32_t bit0_low, uint32_t bit1_high, uint32_t bit1_low);
+  /// Encode LED data while it is being sent instead of into a buffer of RMT items up front, saving 31 bytes of RAM
+  /// per color channel byte at the cost of refilling the RMT memory from an interrupt.
+  void set_use_rmt_translator(bool use_rmt_translator) { this->use_rmt_translator_ = use_rmt_translator; }
 
   void set_rgb_order(RGBOrder rgb_order) { this->rgb_order_ = rgb_order; }
   void set_rmt_channel(rmt_channel_t channel) { this->channel_ = channel; }
@@ -62,18 +68,25 @@ class ESP32RMTLEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPColorSpan get_span_internal() const override;
+  bool is_sending_() override;
+  void send_frame_() override;
+  uint32_t get_frame_checksum_() override;
+  void get_rgb_offsets_(int32_t &r, int32_t &g, int32_t &b) const;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (3 + this->is_rgbw_); }
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
   rmt_item32_t *rmt_buf_{nullptr};
+  uint8_t *tx_buf_{nullptr};
 
   uint8_t pin_;
   uint16_t num_leds_;
   bool is_rgbw_;
 
-  rmt_item32_t bit0_, bit1_;
+  RMTEncoder encoder_;
+  bool use_rmt_translator_{false};
   RGBOrder rgb_order_;
   rmt_channel_t channel_;
 
@@ -57,6 +57,7 @@ CONF_BIT0_LOW = "bit0_low"
 CONF_BIT1_HIGH = "bit1_high"
 CONF_BIT1_LOW = "bit1_low"
 CONF_RMT_CHANNEL = "rmt_channel"
+CONF_USE_RMT_TRANSLATOR = "use_rmt_translator"
 
 RMT_CHANNELS = {
     esp32.const.VARIANT_ESP32: [0, 1, 2, 3, 4, 5, 6, 7],
@@ -90,6 +91,8 @@ CONFIG_SCHEMA = cv.All(
             cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
             cv.Optional(CONF_CHIPSET): cv.one_of(*CHIPSETS, upper=True),
             cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
+            cv.Optional(CONF_USE_RMT_TRANSLATOR, default=False): cv.boolean,
+            cv.Optional(light.CONF_FRAME_GROUP): cv.validate_id_name,
             cv.Inclusive(
                 CONF_BIT0_HIGH,
                 "custom",
@@ -145,6 +148,12 @@ async def to_code(config):
 
     cg.add(var.set_rgb_order(config[CONF_RGB_ORDER]))
     cg.add(var.set_is_rgbw(config[CONF_IS_RGBW]))
+    cg.add(var.set_use_rmt_translator(config[CONF_USE_RMT_TRANSLATOR]))
+
+    if light.CONF_FRAME_GROUP in config:
+        light.add_to_frame_group(
+            var, config[light.CONF_FRAME_GROUP], config.get(CONF_MAX_REFRESH_RATE)
+        )
 
     cg.add(
         var.set_rmt_channel(
@@ -35,6 +35,7 @@ void FastLEDLightOutput::write_state(light::LightState *state) {
 
   ESP_LOGVV(TAG, "Writing RGB values to bus...");
   this->controller_->showLeds();
+  this->record_frame_shown_();
 }
 
 }  // namespace fastled_base
@@ -228,6 +228,11 @@ class FastLEDLightOutput : public light::AddressableLight {
     return {&this->leds_[index].r,      &this->leds_[index].g, &this->leds_[index].b, nullptr,
             &this->effect_data_[index], &this->correction_};
   }
+  light::ESPColorSpan get_span_internal() const override {
+    if (this->leds_ == nullptr)
+      return {};
+    return {&this->leds_[0].r, this->size(), sizeof(CRGB), 0, 1, 2};
+  }
 
   CLEDController *controller_{nullptr};
   CRGB *leds_{nullptr};
@@ -15,12 +15,40 @@ using namespace display;
 static const char *const TAG = "graph";
 static const char *const TAGL = "graphlegend";
 
+static const int16_t NO_COLUMN = INT16_MIN;
+
 void HistoryData::init(int length) {
   this->length_ = length;
   this->samples_.resize(length, NAN);
+  this->min_queue_.init(length);
+  this->max_queue_.init(length);
   this->last_sample_ = millis();
 }
 
+void HistoryData::push_sample_(float data) {
+  // Drop the sample about to be overwritten from the front of the monotonic queues
+  if (this->seq_ >= (uint32_t) this->length_) {
+    uint32_t expired = this->seq_ - this->length_;
+    if (!this->min_queue_.empty() && this->min_queue_.front() == expired)
+      this->min_queue_.pop_front();
+    if (!this->max_queue_.empty() && this->max_queue_.front() == expired)
+      this->max_queue_.pop_front();
+  }
+
+  this->samples_[this->count_] = data;
+  this->count_ = (this->count_ + 1) % this->length_;
+
+  if (!std::isnan(data)) {
+    while (!this->min_queue_.empty() && this->sample_at_(this->min_queue_.back()) >= data)
+      this->min_queue_.pop_back();
+    this->min_queue_.push_back(this->seq_);
+    while (!this->max_queue_.empty() && this->sample_at_(this->max_queue_.back()) <= data)
+      this->max_queue_.pop_back();
+    this->max_queue_.push_back(this->seq_);
+  }
+  this->seq_++;
+}
+
 void HistoryData::take_sample(float data) {
   uint32_t tm = millis();
   uint32_t dt = tm - last_sample_;
@@ -29,33 +57,46 @@ void HistoryData::take_sample(float data) {
   // Step data based on time
   this->period_ += dt;
   while (this->period_ >= this->update_time_) {
-    this->samples_[this->count_] = data;
+    this->push_sample_(data);
     this->period_ -= this->update_time_;
-    this->count_ = (this->count_ + 1) % this->length_;
     ESP_LOGV(TAG, "Updating trace with value: %f", data);
   }
   if (!std::isnan(data)) {
-    // Recalc recent max/min
+    // Recent max/min covers the stored window plus the latest (not yet stored) value
     this->recent_min_ = data;
     this->recent_max_ = data;
-    for (int i = 0; i < this->length_; i++) {
-      if (!std::isnan(this->samples_[i])) {
-        if (this->recent_max_ < this->samples_[i])
-          this->recent_max_ = this->samples_[i];
-        if (this->recent_min_ > this->samples_[i])
-          this->recent_min_ = this->samples_[i];
-      }
-    }
+    if (!this->min_queue_.empty())
+      this->recent_min_ = std::min(this->recent_min_, this->sample_at_(this->min_queue_.front()));
+    if (!this->max_queue_.empty())
+      this->recent_max_ = std::max(this->recent_max_, this->sample_at_(this->max_queue_.front()));
   }
 }
 
 void GraphTrace::init(Graph *g) {
   ESP_LOGI(TAG, "Init trace for sensor %s", this->get_name().c_str());
   this->data_.init(g->get_width());
+  this->columns_.resize(g->get_width(), NO_COLUMN);
   sensor_->add_on_state_callback([this](float state) { this->data_.take_sample(state); });
   this->data_.set_update_time_ms(g->get_duration() * 1000 / g->get_width());
 }
 
+void GraphTrace::update_columns_(uint32_t height, float ymin, float yrange, bool rescale) {
+  const uint32_t length = this->columns_.size();
+  const uint32_t seq = this->data_.get_sequence();
+  // Older columns keep their rows and only scroll along with the ring; new samples are rasterized here
+  uint32_t fresh = rescale ? length : std::min(seq - this->columns_seq_, length);
+  this->columns_seq_ = seq;
+  for (uint32_t i = 0; i < fresh; i++) {
+    float v = (this->data_.get_value(i) - ymin) / yrange;
+    int16_t &column = this->columns_[(seq + length - 1 - i) % length];
+    if (std::isnan(v)) {
+      column = NO_COLUMN;
+    } else {
+      column = (int16_t) roundf((height - 1) * (1.0 - v)) - this->line_thickness_ / 2;
+    }
+  }
+}
+
 void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color color) {
   /// Plot border
   if (this->border_) {
@@ -162,19 +203,24 @@ void Graph::draw(Display *buff, uint16_t x_offset, uint16_t y_offset, Color colo
 
   /// Draw traces
   ESP_LOGV(TAG, "Updating graph. ymin %f, ymax %f", ymin, ymax);
+  bool rescale = ymin != this->plotted_ymin_ || yrange != this->plotted_yrange_;
+  this->plotted_ymin_ = ymin;
+  this->plotted_yrange_ = yrange;
   for (auto *trace : traces_) {
+    trace->update_columns_(this->height_, ymin, yrange, rescale);
     Color c = trace->get_line_color();
     uint16_t thick = trace->get_line_thickness();
+    if (thick == 0)
+      continue;
     for (uint32_t i = 0; i < this->width_; i++) {
-      float v = (trace->get_tracedata()->get_value(i) - ymin) / yrange;
-      if (!std::isnan(v) && (thick > 0)) {
-        int16_t x = this->width_ - 1 - i;
-        uint8_t b = (i % (thick * LineType::PATTERN_LENGTH)) / thick;
-        if (((uint8_t) trace->get_line_type() & (1 << b)) == (1 << b)) {
-          int16_t y = (int16_t) roundf((this->height_ - 1) * (1.0 - v)) - thick / 2;
-          for (uint16_t t = 0; t < thick; t++) {
-            buff->draw_pixel_at(x_offset + x, y_offset + y + t, c);
-          }
+      int16_t y = trace->get_column_(i);
+      if (y == NO_COLUMN)
+        continue;
+      int16_t x = this->width_ - 1 - i;
+      uint8_t b = (i % (thick * LineType::PATTERN_LENGTH)) / thick;
+      if (((uint8_t) trace->get_line_type() & (1 << b)) == (1 << b)) {
+        for (uint16_t t = 0; t < thick; t++) {
+          buff->draw_pixel_at(x_offset + x, y_offset + y + t, c);
         }
       }
     }
@@ -83,6 +83,39 @@ class GraphLegend {
   friend Graph;
 };
 
+/// Fixed capacity FIFO of sample sequence numbers, used to keep a monotonic window over HistoryData.
+class SampleIndexQueue {
+ public:
+  void init(int capacity) {
+    this->items_.resize(capacity);
+    this->head_ = 0;
+    this->size_ = 0;
+  }
+  bool empty() const { return this->size_ == 0; }
+  uint32_t front() const { return this->items_[this->head_]; }
+  uint32_t back() const { return this->items_[(this->head_ + this->size_ - 1) % this->items_.size()]; }
+  void pop_front() {
+    this->head_ = (this->head_ + 1) % this->items_.size();
+    this->size_--;
+  }
+  void pop_back() { this->size_--; }
+  void push_back(uint32_t seq) {
+    this->items_[(this->head_ + this->size_) % this->items_.size()] = seq;
+    this->size_++;
+  }
+
+ protected:
+  std::vector<uint32_t> items_;
+  size_t head_{0};
+  size_t size_{0};
+};
+
+/** Ring buffer of samples for one trace.
+ *
+ * The minimum and maximum of all samples currently in the ring are kept up to date with a pair of
+ * monotonic queues, so taking a sample and querying the range are both O(1) (amortized), independent
+ * of the graph width.
+ */
 class HistoryData {
  public:
   void init(int length);
@@ -90,19 +123,26 @@ class HistoryData {
   void set_update_time_ms(uint32_t update_time_ms) { update_time_ = update_time_ms; }
   void take_sample(float data);
   int get_length() const { return length_; }
+  uint32_t get_sequence() const { return seq_; }
   float get_value(int idx) const { return samples_[(count_ + length_ - 1 - idx) % length_]; }
   float get_recent_max() const { return recent_max_; }
   float get_recent_min() const { return recent_min_; }
 
  protected:
+  void push_sample_(float data);
+  float sample_at_(uint32_t seq) const { return samples_[seq % length_]; }
+
   uint32_t last_sample_;
   uint32_t period_{0};       /// in ms
   uint32_t update_time_{0};  /// in ms
   int length_;
   int count_{0};
+  uint32_t seq_{0};  /// total number of samples pushed, the ring position is seq_ % length_
   float recent_min_{NAN};
   float recent_max_{NAN};
   std::vector<float> samples_;
+  SampleIndexQueue min_queue_;  /// sequence numbers of ascending samples, front is the window minimum
+  SampleIndexQueue max_queue_;  /// sequence numbers of descending samples, front is the window maximum
 };
 
 class GraphTrace {
@@ -117,15 +157,24 @@ class GraphTrace {
   Color get_line_color() { return this->line_color_; }
   void set_line_color(Color val) { this->line_color_ = val; }
   std::string get_name() { return name_; }
+  sensor::Sensor *get_sensor() { return sensor_; }
   const HistoryData *get_tracedata() { return &data_; }
 
  protected:
+  /// Rasterize the columns of samples taken since the last call, or all of them when the y-axis changed.
+  void update_columns_(uint32_t height, float ymin, float yrange, bool rescale);
+  int16_t get_column_(int idx) const {
+    return this->columns_[(this->data_.get_sequence() + this->columns_.size() - 1 - idx) % this->columns_.size()];
+  }
+
   sensor::Sensor *sensor_{nullptr};
   std::string name_{""};
   uint8_t line_thickness_{3};
   enum LineType line_type_ { LINE_TYPE_SOLID };
   Color line_color_{COLOR_ON};
   HistoryData data_;
+  std::vector<int16_t> columns_;  /// top pixel row of each sample's line segment, ring indexed like data_
+  uint32_t columns_seq_{0};       /// sample sequence number the columns are rasterized up to
 
   friend Graph;
   friend GraphLegend;
@@ -155,6 +204,7 @@ class Graph : public Component {
     this->legend_ = legend;
     legend->init(this);
   }
+  const std::vector<GraphTrace *> &get_traces() const { return traces_; }
   uint32_t get_duration() { return duration_; }
   uint32_t get_width() { return width_; }
   uint32_t get_height() { return height_; }
@@ -172,6 +222,9 @@ class Graph : public Component {
   bool border_{true};
   std::vector<GraphTrace *> traces_;
   GraphLegend *legend_{nullptr};
+  // y-axis the trace columns were last rasterized for
+  float plotted_ymin_{NAN};
+  float plotted_yrange_{NAN};
 
   friend GraphLegend;
 };
@@ -0,0 +1,3 @@
+import esphome.codegen as cg
+
+host_framebuffer_ns = cg.esphome_ns.namespace("host_framebuffer")
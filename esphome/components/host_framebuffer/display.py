@@ -0,0 +1,64 @@
+import re
+
+import esphome.codegen as cg
+import esphome.config_validation as cv
+from esphome.components import display
+from esphome.const import (
+    CONF_DIMENSIONS,
+    CONF_ID,
+    CONF_LAMBDA,
+    PLATFORM_HOST,
+)
+from . import host_framebuffer_ns
+
+CONF_COLOR_DEPTH = "color_depth"
+CONF_DUMP_FRAMES = "dump_frames"
+CONF_STATS_EVERY = "stats_every"
+
+HostFramebuffer = host_framebuffer_ns.class_(
+    "HostFramebuffer", cg.PollingComponent, display.DisplayBuffer
+)
+
+
+def validate_dump_frames(value):
+    value = cv.string_strict(value)
+    if not re.fullmatch(r"[^%]*%0?[0-9]*d[^%]*", value):
+        raise cv.Invalid(
+            "Must contain one integer placeholder for the frame number, "
+            "like 'frame_%05d.ppm'"
+        )
+    return value
+
+
+CONFIG_SCHEMA = cv.All(
+    display.FULL_DISPLAY_SCHEMA.extend(
+        {
+            cv.GenerateID(): cv.declare_id(HostFramebuffer),
+            cv.Required(CONF_DIMENSIONS): cv.dimensions,
+            cv.Optional(CONF_COLOR_DEPTH, default=24): cv.one_of(
+                1, 8, 16, 24, int=True
+            ),
+            cv.Optional(CONF_DUMP_FRAMES): validate_dump_frames,
+            cv.Optional(CONF_STATS_EVERY, default=10): cv.positive_not_null_int,
+        }
+    ).extend(cv.polling_component_schema("1s")),
+    cv.only_on(PLATFORM_HOST),
+)
+
+
+async def to_code(config):
+    var = cg.new_Pvariable(config[CONF_ID])
+    await cg.register_component(var, config)
+    await display.register_display(var, config)
+
+    cg.add(var.set_dimensions(*config[CONF_DIMENSIONS]))
+    cg.add(var.set_color_depth(config[CONF_COLOR_DEPTH]))
+    cg.add(var.set_stats_every(config[CONF_STATS_EVERY]))
+    if CONF_DUMP_FRAMES in config:
+        cg.add(var.set_dump_frames(config[CONF_DUMP_FRAMES]))
+
+    if CONF_LAMBDA in config:
+        lambda_ = await cg.process_lambda(
+            config[CONF_LAMBDA], [(display.DisplayRef, "it")], return_type=cg.void
+        )
+        cg.add(var.set_writer(lambda_))
@@ -0,0 +1,211 @@
+#ifdef USE_HOST
+
+#include "host_framebuffer.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "esphome/components/display/display_color_utils.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+
+namespace esphome {
+namespace host_framebuffer {
+
+static const char *const TAG = "host_framebuffer";
+
+void HostFramebuffer::setup() { this->init_internal_(this->get_buffer_length_()); }
+
+void HostFramebuffer::dump_config() {
+  LOG_DISPLAY("", "Host Framebuffer", this);
+  ESP_LOGCONFIG(TAG, "  Color depth: %u bits", this->color_depth_);
+  if (!this->dump_frames_.empty())
+    ESP_LOGCONFIG(TAG, "  Dump frames: %s", this->dump_frames_.c_str());
+  LOG_UPDATE_INTERVAL(this);
+}
+
+void HostFramebuffer::update() {
+  if (this->buffer_ == nullptr)
+    return;
+
+  // The page lambda may switch pages, so attribute the frame to the page it started with
+  const display::DisplayPage *page = this->get_active_page();
+  this->pixel_writes_ = 0;
+  const uint32_t start = micros();
+  this->do_update_();
+  this->last_frame_time_us_ = micros() - start;
+  this->last_frame_pixel_writes_ = this->pixel_writes_;
+
+  this->frame_count_++;
+  this->record_page_stats_(page);
+  const display::Rect damage = this->get_damage_internal_();
+  if (damage.is_set()) {
+    ESP_LOGV(TAG, "Frame %" PRIu32 ": %" PRIu32 " us, %" PRIu32 " pixel writes, damage x:%d y:%d w:%d h:%d",
+             this->frame_count_, this->last_frame_time_us_, this->last_frame_pixel_writes_, damage.x, damage.y,
+             damage.w, damage.h);
+  } else {
+    ESP_LOGV(TAG, "Frame %" PRIu32 ": %" PRIu32 " us, %" PRIu32 " pixel writes, nothing changed", this->frame_count_,
+             this->last_frame_time_us_, this->last_frame_pixel_writes_);
+  }
+  if (this->frame_count_ % this->stats_every_ == 0)
+    this->log_stats_();
+
+  if (!this->dump_frames_.empty())
+    this->write_ppm_();
+}
+
+void HostFramebuffer::record_page_stats_(const display::DisplayPage *page) {
+  auto it = std::find_if(this->page_stats_.begin(), this->page_stats_.end(),
+                         [page](const PageStats &stats) { return stats.page == page; });
+  if (it == this->page_stats_.end())
+    it = this->page_stats_.insert(it, PageStats{page, 0, 0, 0});
+  it->frames++;
+  it->total_frame_time_us += this->last_frame_time_us_;
+  it->total_pixel_writes += this->last_frame_pixel_writes_;
+}
+
+void HostFramebuffer::log_stats_() {
+  ESP_LOGD(TAG, "%" PRIu32 " frames:", this->frame_count_);
+  for (size_t i = 0; i < this->page_stats_.size(); i++) {
+    const PageStats &stats = this->page_stats_[i];
+    if (stats.page == nullptr) {
+      ESP_LOGD(TAG, "  Display lambda: %" PRIu32 " frames, %.1f us and %.0f pixel writes per frame", stats.frames,
+               (double) stats.total_frame_time_us / stats.frames, (double) stats.total_pixel_writes / stats.frames);
+    } else {
+      ESP_LOGD(TAG, "  Page %zu: %" PRIu32 " frames, %.1f us and %.0f pixel writes per frame", i + 1, stats.frames,
+               (double) stats.total_frame_time_us / stats.frames, (double) stats.total_pixel_writes / stats.frames);
+    }
+  }
+}
+
+display::DisplayType HostFramebuffer::get_display_type() {
+  switch (this->color_depth_) {
+    case 1:
+      return display::DisplayType::DISPLAY_TYPE_BINARY;
+    case 8:
+      return display::DisplayType::DISPLAY_TYPE_GRAYSCALE;
+    default:
+      return display::DisplayType::DISPLAY_TYPE_COLOR;
+  }
+}
+
+size_t HostFramebuffer::get_buffer_length_() const {
+  if (this->color_depth_ == 1)
+    return (this->width_ + 7u) / 8u * this->height_;
+  return (size_t) this->width_ * this->height_ * (this->color_depth_ / 8u);
+}
+
+void HostFramebuffer::fill(Color color) {
+  if (this->color_depth_ == 24) {
+    for (size_t i = 0; i < this->get_buffer_length_(); i += 3) {
+      this->buffer_[i + 0] = color.r;
+      this->buffer_[i + 1] = color.g;
+      this->buffer_[i + 2] = color.b;
+    }
+    return;
+  }
+  if (this->color_depth_ == 16) {
+    const uint16_t rgb565 = display::ColorUtil::color_to_565(color);
+    for (size_t i = 0; i < this->get_buffer_length_(); i += 2) {
+      this->buffer_[i + 0] = rgb565 >> 8;
+      this->buffer_[i + 1] = rgb565;
+    }
+    return;
+  }
+  uint8_t value;
+  if (this->color_depth_ == 8) {
+    value = (color.r * 77 + color.g * 150 + color.b * 29) >> 8;
+  } else {
+    value = color.is_on() ? 0xFF : 0x00;
+  }
+  memset(this->buffer_, value, this->get_buffer_length_());
+}
+
+void HOT HostFramebuffer::draw_absolute_pixel_internal(int x, int y, Color color) {
+  if (x >= this->width_ || y >= this->height_ || x < 0 || y < 0)
+    return;
+  this->pixel_writes_++;
+
+  switch (this->color_depth_) {
+    case 1: {
+      const uint32_t pos = y * ((this->width_ + 7u) / 8u) + x / 8u;
+      if (color.is_on()) {
+        this->buffer_[pos] |= 0x80 >> (x & 0x07);
+      } else {
+        this->buffer_[pos] &= ~(0x80 >> (x & 0x07));
+      }
+      break;
+    }
+    case 8:
+      this->buffer_[y * this->width_ + x] = (color.r * 77 + color.g * 150 + color.b * 29) >> 8;
+      break;
+    case 16: {
+      const uint32_t pos = (y * this->width_ + x) * 2;
+      const uint16_t rgb565 = display::ColorUtil::color_to_565(color);
+      this->buffer_[pos + 0] = rgb565 >> 8;
+      this->buffer_[pos + 1] = rgb565;
+      break;
+    }
+    default: {
+      const uint32_t pos = (y * this->width_ + x) * 3;
+      this->buffer_[pos + 0] = color.r;
+      this->buffer_[pos + 1] = color.g;
+      this->buffer_[pos + 2] = color.b;
+      break;
+    }
+  }
+}
+
+Color HostFramebuffer::get_pixel(int x, int y) const {
+  if (this->buffer_ == nullptr || x >= this->width_ || y >= this->height_ || x < 0 || y < 0)
+    return display::COLOR_OFF;
+
+  switch (this->color_depth_) {
+    case 1: {
+      const uint32_t pos = y * ((this->width_ + 7u) / 8u) + x / 8u;
+      return (this->buffer_[pos] & (0x80 >> (x & 0x07))) ? display::COLOR_ON : display::COLOR_OFF;
+    }
+    case 8: {
+      const uint8_t gray = this->buffer_[y * this->width_ + x];
+      return Color(gray, gray, gray);
+    }
+    case 16: {
+      const uint32_t pos = (y * this->width_ + x) * 2;
+      const uint16_t rgb565 = (this->buffer_[pos] << 8) | this->buffer_[pos + 1];
+      const uint8_t r = (rgb565 >> 11) & 0x1F;
+      const uint8_t g = (rgb565 >> 5) & 0x3F;
+      const uint8_t b = rgb565 & 0x1F;
+      return Color((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2));
+    }
+    default: {
+      const uint32_t pos = (y * this->width_ + x) * 3;
+      return Color(this->buffer_[pos], this->buffer_[pos + 1], this->buffer_[pos + 2]);
+    }
+  }
+}
+
+void HostFramebuffer::write_ppm_() {
+  char path[256];
+  snprintf(path, sizeof(path), this->dump_frames_.c_str(), (int) this->frame_count_);
+  FILE *file = fopen(path, "wb");
+  if (file == nullptr) {
+    ESP_LOGW(TAG, "Could not open %s for writing", path);
+    return;
+  }
+  fprintf(file, "P6\n%d %d\n255\n", this->width_, this->height_);
+  for (int y = 0; y < this->height_; y++) {
+    for (int x = 0; x < this->width_; x++) {
+      Color color = this->get_pixel(x, y);
+      const uint8_t rgb[3] = {color.r, color.g, color.b};
+      fwrite(rgb, 1, sizeof(rgb), file);
+    }
+  }
+  fclose(file);
+}
+
+}  // namespace host_framebuffer
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,82 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <string>
+#include <vector>
+
+#include "esphome/core/component.h"
+#include "esphome/components/display/display_buffer.h"
+
+namespace esphome {
+namespace host_framebuffer {
+
+/** In-memory display for the host platform.
+ *
+ * Renders into a plain framebuffer so drawing code can be profiled and compared against golden images
+ * off-device. Every update is timed and the number of pixel writes is counted; optionally each frame is
+ * written to a binary PPM file.
+ */
+class HostFramebuffer : public PollingComponent, public display::DisplayBuffer {
+ public:
+  void setup() override;
+  void update() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::PROCESSOR; }
+
+  void set_dimensions(int width, int height) {
+    this->width_ = width;
+    this->height_ = height;
+  }
+  void set_color_depth(uint8_t color_depth) { this->color_depth_ = color_depth; }
+  void set_dump_frames(const std::string &dump_frames) { this->dump_frames_ = dump_frames; }
+  void set_stats_every(uint32_t stats_every) { this->stats_every_ = stats_every; }
+
+  display::DisplayType get_display_type() override;
+  void fill(Color color) override;
+
+  /// Read back a pixel in framebuffer coordinates (without rotation), as stored at the configured color depth.
+  Color get_pixel(int x, int y) const;
+
+  uint32_t get_frame_count() const { return this->frame_count_; }
+  /// Time spent rendering the last frame, in microseconds.
+  uint32_t get_last_frame_time_us() const { return this->last_frame_time_us_; }
+  /// Number of draw_pixel_at() calls that reached the framebuffer during the last frame.
+  uint32_t get_last_frame_pixel_writes() const { return this->last_frame_pixel_writes_; }
+
+ protected:
+  int get_width_internal() override { return this->width_; }
+  int get_height_internal() override { return this->height_; }
+  void draw_absolute_pixel_internal(int x, int y, Color color) override;
+
+  struct PageStats {
+    /// The page, or nullptr for frames drawn by the display's own lambda.
+    const display::DisplayPage *page;
+    uint32_t frames;
+    uint64_t total_frame_time_us;
+    uint64_t total_pixel_writes;
+  };
+
+  size_t get_buffer_length_() const;
+  void write_ppm_();
+  void record_page_stats_(const display::DisplayPage *page);
+  void log_stats_();
+
+  int width_{0};
+  int height_{0};
+  uint8_t color_depth_{24};
+  std::string dump_frames_;
+  uint32_t stats_every_{10};
+
+  uint32_t frame_count_{0};
+  uint32_t pixel_writes_{0};
+  uint32_t last_frame_time_us_{0};
+  uint32_t last_frame_pixel_writes_{0};
+  /// Statistics of each page, in the order the pages were first shown.
+  std::vector<PageStats> page_stats_;
+};
+
+}  // namespace host_framebuffer
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -39,12 +39,16 @@ void HTU21DComponent::dump_config() {
   LOG_SENSOR("  ", "Humidity", this->humidity_);
 }
 void HTU21DComponent::update() {
-  uint16_t raw_temperature;
   if (this->write(&HTU21D_REGISTER_TEMPERATURE, 1) != i2c::ERROR_OK) {
     this->status_set_warning();
     return;
   }
-  delay(50);  // NOLINT
+  // Let the other devices on the bus run while the sensor converts; a new update replaces the pending read
+  this->schedule_transaction(50, [this]() { this->read_temperature_(); });
+}
+
+void HTU21DComponent::read_temperature_() {
+  uint16_t raw_temperature;
   if (this->read(reinterpret_cast<uint8_t *>(&raw_temperature), 2) != i2c::ERROR_OK) {
     this->status_set_warning();
     return;
@@ -53,12 +57,15 @@ void HTU21DComponent::update() {
 
   float temperature = (float(raw_temperature & 0xFFFC)) * 175.72f / 65536.0f - 46.85f;
 
-  uint16_t raw_humidity;
   if (this->write(&HTU21D_REGISTER_HUMIDITY, 1) != i2c::ERROR_OK) {
     this->status_set_warning();
     return;
   }
-  delay(50);  // NOLINT
+  this->schedule_transaction(50, [this, temperature]() { this->read_humidity_(temperature); });
+}
+
+void HTU21DComponent::read_humidity_(float temperature) {
+  uint16_t raw_humidity;
   if (this->read(reinterpret_cast<uint8_t *>(&raw_humidity), 2) != i2c::ERROR_OK) {
     this->status_set_warning();
     return;
@@ -28,6 +28,9 @@ class HTU21DComponent : public PollingComponent, public i2c::I2CDevice {
   float get_setup_priority() const override;
 
  protected:
+  void read_temperature_();
+  void read_humidity_(float temperature);
+
   sensor::Sensor *temperature_{nullptr};
   sensor::Sensor *humidity_{nullptr};
   sensor::Sensor *heater_{nullptr};
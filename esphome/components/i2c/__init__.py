@@ -14,6 +14,7 @@ from esphome.const import (
     CONF_I2C_ID,
     PLATFORM_ESP32,
     PLATFORM_ESP8266,
+    PLATFORM_HOST,
     PLATFORM_RP2040,
 )
 from esphome.core import coroutine_with_priority, CORE
@@ -23,15 +24,19 @@ i2c_ns = cg.esphome_ns.namespace("i2c")
 I2CBus = i2c_ns.class_("I2CBus")
 ArduinoI2CBus = i2c_ns.class_("ArduinoI2CBus", I2CBus, cg.Component)
 IDFI2CBus = i2c_ns.class_("IDFI2CBus", I2CBus, cg.Component)
+HostI2CBus = i2c_ns.class_("HostI2CBus", I2CBus, cg.Component)
 I2CDevice = i2c_ns.class_("I2CDevice")
 
 
 CONF_SDA_PULLUP_ENABLED = "sda_pullup_enabled"
 CONF_SCL_PULLUP_ENABLED = "scl_pullup_enabled"
+CONF_BYTE_TIME = "byte_time"
 MULTI_CONF = True
 
 
 def _bus_declare_type(value):
+    if CORE.is_host:
+        return cv.declare_id(HostI2CBus)(value)
     if CORE.using_arduino:
         return cv.declare_id(ArduinoI2CBus)(value)
     if CORE.using_esp_idf:
@@ -45,15 +50,36 @@ pin_with_input_and_output_support = cv.All(
 )
 
 
+def validate_host_bus(config):
+    if CORE.is_host:
+        for key in (CONF_SDA, CONF_SCL):
+            if key in config:
+                raise cv.Invalid(
+                    "The bus is simulated on the host platform and has no pins",
+                    path=[key],
+                )
+        return config
+    if CONF_BYTE_TIME in config:
+        raise cv.Invalid(
+            "The byte time option is only available on the host platform",
+            path=[CONF_BYTE_TIME],
+        )
+    return config
+
+
 CONFIG_SCHEMA = cv.All(
     cv.Schema(
         {
             cv.GenerateID(): _bus_declare_type,
-            cv.Optional(CONF_SDA, default="SDA"): pin_with_input_and_output_support,
+            cv.SplitDefault(
+                CONF_SDA, esp8266="SDA", esp32="SDA", rp2040="SDA"
+            ): pin_with_input_and_output_support,
             cv.SplitDefault(CONF_SDA_PULLUP_ENABLED, esp32_idf=True): cv.All(
                 cv.only_with_esp_idf, cv.boolean
             ),
-            cv.Optional(CONF_SCL, default="SCL"): pin_with_input_and_output_support,
+            cv.SplitDefault(
+                CONF_SCL, esp8266="SCL", esp32="SCL", rp2040="SCL"
+            ): pin_with_input_and_output_support,
             cv.SplitDefault(CONF_SCL_PULLUP_ENABLED, esp32_idf=True): cv.All(
                 cv.only_with_esp_idf, cv.boolean
             ),
@@ -61,9 +87,11 @@ CONFIG_SCHEMA = cv.All(
                 cv.frequency, cv.Range(min=0, min_included=False)
             ),
             cv.Optional(CONF_SCAN, default=True): cv.boolean,
+            cv.Optional(CONF_BYTE_TIME): cv.positive_time_period_microseconds,
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_RP2040]),
+    cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_RP2040, PLATFORM_HOST]),
+    validate_host_bus,
 )
 
 
@@ -73,15 +101,19 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
-    cg.add(var.set_sda_pin(config[CONF_SDA]))
+    if CONF_SDA in config:
+        cg.add(var.set_sda_pin(config[CONF_SDA]))
     if CONF_SDA_PULLUP_ENABLED in config:
         cg.add(var.set_sda_pullup_enabled(config[CONF_SDA_PULLUP_ENABLED]))
-    cg.add(var.set_scl_pin(config[CONF_SCL]))
+    if CONF_SCL in config:
+        cg.add(var.set_scl_pin(config[CONF_SCL]))
     if CONF_SCL_PULLUP_ENABLED in config:
         cg.add(var.set_scl_pullup_enabled(config[CONF_SCL_PULLUP_ENABLED]))
 
     cg.add(var.set_frequency(int(config[CONF_FREQUENCY])))
     cg.add(var.set_scan(config[CONF_SCAN]))
+    if CONF_BYTE_TIME in config:
+        cg.add(var.set_byte_time(config[CONF_BYTE_TIME].total_microseconds))
     if CORE.using_arduino:
         cg.add_library("Wire", None)
 
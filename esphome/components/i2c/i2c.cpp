@@ -1,5 +1,8 @@
 #include "i2c.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
+#include <algorithm>
+#include <cinttypes>
 #include <memory>
 
 namespace esphome {
@@ -7,6 +10,45 @@ namespace i2c {
 
 static const char *const TAG = "i2c";
 
+static const uint32_t MAX_SCHEDULED_TIME = 10;
+
+void I2CBus::schedule_transaction(const void *owner, uint32_t delay_ms, std::function<void()> &&transaction) {
+  const uint32_t deadline = millis() + delay_ms;
+  for (auto &scheduled : this->scheduled_) {
+    if (scheduled.owner == owner) {
+      scheduled.deadline = deadline;
+      scheduled.transaction = std::move(transaction);
+      return;
+    }
+  }
+  this->scheduled_.push_back({owner, deadline, std::move(transaction)});
+}
+
+void I2CBus::cancel_transaction(const void *owner) {
+  this->scheduled_.erase(std::remove_if(this->scheduled_.begin(), this->scheduled_.end(),
+                                        [owner](const ScheduledTransaction &s) { return s.owner == owner; }),
+                         this->scheduled_.end());
+}
+
+void I2CBus::run_scheduled_() {
+  const uint32_t start = millis();
+  while (!this->scheduled_.empty()) {
+    auto next = std::min_element(this->scheduled_.begin(), this->scheduled_.end(),
+                                 [](const ScheduledTransaction &a, const ScheduledTransaction &b) {
+                                   return int32_t(a.deadline - b.deadline) < 0;
+                                 });
+    const uint32_t now = millis();
+    if (int32_t(now - next->deadline) < 0 || now - start >= MAX_SCHEDULED_TIME)
+      return;
+    if (now - next->deadline > MAX_SCHEDULED_TIME)
+      ESP_LOGV(TAG, "Scheduled transaction runs %" PRIu32 " ms late", now - next->deadline);
+    // The transaction may schedule the next step of its device, so take it off the list before running it
+    auto transaction = std::move(next->transaction);
+    this->scheduled_.erase(next);
+    transaction();
+  }
+}
+
 ErrorCode I2CDevice::read_register(uint8_t a_register, uint8_t *data, size_t len, bool stop) {
   ErrorCode err = this->write(&a_register, 1, stop);
   if (err != ERROR_OK)
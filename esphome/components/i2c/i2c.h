@@ -61,6 +61,7 @@ class I2CDevice {
 
   void set_i2c_address(uint8_t address) { address_ = address; }
   void set_i2c_bus(I2CBus *bus) { bus_ = bus; }
+  I2CBus *get_i2c_bus() const { return this->bus_; }
 
   I2CRegister reg(uint8_t a_register) { return {this, a_register}; }
   I2CRegister16 reg16(uint16_t a_register) { return {this, a_register}; }
@@ -73,6 +74,13 @@ class I2CDevice {
   ErrorCode write_register(uint8_t a_register, const uint8_t *data, size_t len, bool stop = true);
   ErrorCode write_register16(uint16_t a_register, const uint8_t *data, size_t len, bool stop = true);
 
+  /// Run `transaction` once `delay_ms` have passed, taking turns with the other devices on the bus. Replaces the
+  /// transaction this device still has pending.
+  void schedule_transaction(uint32_t delay_ms, std::function<void()> &&transaction) {
+    this->bus_->schedule_transaction(this, delay_ms, std::move(transaction));
+  }
+  void cancel_transaction() { this->bus_->cancel_transaction(this); }
+
   // Compat APIs
 
   bool read_bytes(uint8_t a_register, uint8_t *data, uint8_t len) {
@@ -1,6 +1,7 @@
 #pragma once
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <utility>
 #include <vector>
 
@@ -50,7 +51,28 @@ class I2CBus {
   }
   virtual ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) = 0;
 
+  /** Run `transaction` from the loop of the bus once `delay_ms` have passed, e.g. to read the result of a conversion
+   * instead of blocking in delay() until it is ready.
+   *
+   * Each owner has at most one pending transaction; scheduling another one replaces it, so a new measurement cycle
+   * cancels the remaining steps of the previous one. Due transactions of all devices on the bus run one after another
+   * in the order of their deadlines. Once they have taken MAX_SCHEDULED_TIME ms in one loop iteration, the rest wait
+   * for the next iteration.
+   */
+  virtual void schedule_transaction(const void *owner, uint32_t delay_ms, std::function<void()> &&transaction);
+  /// Drop the pending transaction of `owner`, if any.
+  virtual void cancel_transaction(const void *owner);
+
  protected:
+  struct ScheduledTransaction {
+    const void *owner;
+    uint32_t deadline;
+    std::function<void()> transaction;
+  };
+
+  /// Run the scheduled transactions that are due; the bus components call this from their loop().
+  void run_scheduled_();
+
   void i2c_scan_() {
     for (uint8_t address = 8; address < 120; address++) {
       auto err = writev(address, nullptr, 0);
@@ -63,6 +85,7 @@ class I2CBus {
   }
   std::vector<std::pair<uint8_t, bool>> scan_results_;
   bool scan_{false};
+  std::vector<ScheduledTransaction> scheduled_;
 };
 
 }  // namespace i2c
@@ -0,0 +1,113 @@
+#ifdef USE_HOST
+
+#include "i2c_bus_host.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include <algorithm>
+#include <cinttypes>
+
+namespace esphome {
+namespace i2c {
+
+static const char *const TAG = "i2c.host";
+
+static const uint32_t STATS_INTERVAL = 60000;
+static const size_t REGISTER_COUNT = 256;
+
+void HostI2CBus::setup() {
+  if (this->byte_time_us_ == 0) {
+    // 8 data bits and the acknowledge bit
+    this->byte_time_us_ = std::max<uint32_t>(9000000 / this->frequency_, 1);
+  }
+  this->registers_.assign((MAX_ADDRESS + 1) * REGISTER_COUNT, 0);
+  this->initialized_ = true;
+  if (this->scan_) {
+    ESP_LOGV(TAG, "Scanning i2c bus for active devices...");
+    this->i2c_scan_();
+  }
+  this->stats_start_us_ = micros();
+  this->set_interval("stats", STATS_INTERVAL, [this]() { this->log_stats_(); });
+}
+
+void HostI2CBus::dump_config() {
+  ESP_LOGCONFIG(TAG, "I2C Bus:");
+  ESP_LOGCONFIG(TAG, "  Simulated on the host");
+  ESP_LOGCONFIG(TAG, "  Frequency: %" PRIu32 " Hz", this->frequency_);
+  ESP_LOGCONFIG(TAG, "  Byte time: %" PRIu32 " us", this->byte_time_us_);
+  if (this->scan_) {
+    ESP_LOGI(TAG, "Results from i2c bus scan:");
+    ESP_LOGI(TAG, "Found %zu simulated i2c devices", this->scan_results_.size());
+  }
+}
+
+ErrorCode HostI2CBus::readv(uint8_t address, ReadBuffer *buffers, size_t cnt) {
+  if (!this->initialized_) {
+    ESP_LOGVV(TAG, "i2c bus not initialized!");
+    return ERROR_NOT_INITIALIZED;
+  }
+  if (address > MAX_ADDRESS)
+    return ERROR_INVALID_ARGUMENT;
+
+  const uint8_t *registers = &this->registers_[address * REGISTER_COUNT];
+  uint8_t &pointer = this->pointers_[address];
+  size_t len = 0;
+  for (size_t i = 0; i < cnt; i++) {
+    const auto &buf = buffers[i];
+    for (size_t j = 0; j < buf.len; j++)
+      buf.data[j] = registers[pointer++];
+    len += buf.len;
+  }
+  this->transfer_(len);
+  return ERROR_OK;
+}
+
+ErrorCode HostI2CBus::writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) {
+  if (!this->initialized_) {
+    ESP_LOGVV(TAG, "i2c bus not initialized!");
+    return ERROR_NOT_INITIALIZED;
+  }
+  if (address > MAX_ADDRESS)
+    return ERROR_INVALID_ARGUMENT;
+
+  uint8_t *registers = &this->registers_[address * REGISTER_COUNT];
+  uint8_t &pointer = this->pointers_[address];
+  size_t len = 0;
+  for (size_t i = 0; i < cnt; i++) {
+    const auto &buf = buffers[i];
+    for (size_t j = 0; j < buf.len; j++, len++) {
+      if (len == 0) {
+        pointer = buf.data[j];
+      } else {
+        registers[pointer++] = buf.data[j];
+      }
+    }
+  }
+  this->transfer_(len);
+  return ERROR_OK;
+}
+
+void HostI2CBus::transfer_(size_t len) {
+  const uint32_t duration = this->byte_time_us_ * (len + 1);
+  delayMicroseconds(duration);
+  this->busy_us_ += duration;
+  this->transactions_++;
+  this->bytes_ += len;
+}
+
+void HostI2CBus::log_stats_() {
+  const uint32_t now = micros();
+  this->bus_utilization_ = std::min(float(this->busy_us_) / float(now - this->stats_start_us_), 1.0f);
+  this->stats_start_us_ = now;
+  if (this->transactions_ > 0) {
+    ESP_LOGD(TAG, "%" PRIu32 " transactions, %" PRIu32 " bytes, bus utilization %.1f%%", this->transactions_,
+             this->bytes_, this->bus_utilization_ * 100.0f);
+  }
+  this->busy_us_ = 0;
+  this->transactions_ = 0;
+  this->bytes_ = 0;
+}
+
+}  // namespace i2c
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -0,0 +1,60 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include "i2c_bus.h"
+#include "esphome/core/component.h"
+#include <vector>
+
+namespace esphome {
+namespace i2c {
+
+/** Simulated I2C bus on the host, for benchmarks.
+ *
+ * Every address answers like a device with 256 byte-wide registers: the first byte of a write sets the register
+ * pointer and the following bytes are stored from there on, reads continue from the register pointer. Each transferred
+ * byte, including the address byte, takes as long as on a real bus: 9 clock cycles at the configured frequency, or the
+ * configured byte time.
+ */
+class HostI2CBus : public I2CBus, public Component {
+ public:
+  void setup() override;
+  void loop() override { this->run_scheduled_(); }
+  void dump_config() override;
+  ErrorCode readv(uint8_t address, ReadBuffer *buffers, size_t cnt) override;
+  ErrorCode writev(uint8_t address, WriteBuffer *buffers, size_t cnt, bool stop) override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  void set_scan(bool scan) { scan_ = scan; }
+  void set_frequency(uint32_t frequency) { frequency_ = frequency; }
+  /// Time to transfer one byte in µs; 0 derives it from the frequency.
+  void set_byte_time(uint32_t byte_time_us) { byte_time_us_ = byte_time_us; }
+
+  /// Share of time the bus was busy with transfers during the last statistics interval, from 0 to 1.
+  float get_bus_utilization() const { return this->bus_utilization_; }
+
+ protected:
+  static const uint8_t MAX_ADDRESS = 0x7F;
+
+  /// Block for the time the bus needs to transfer the address byte and `len` data bytes.
+  void transfer_(size_t len);
+  void log_stats_();
+
+  uint32_t frequency_;
+  uint32_t byte_time_us_{0};
+  /// 256 registers for each address.
+  std::vector<uint8_t> registers_;
+  uint8_t pointers_[MAX_ADDRESS + 1]{};
+  bool initialized_ = false;
+
+  uint32_t stats_start_us_{0};
+  uint32_t busy_us_{0};
+  uint32_t transactions_{0};
+  uint32_t bytes_{0};
+  float bus_utilization_{0.0f};
+};
+
+}  // namespace i2c
+}  // namespace esphome
+
+#endif  // USE_HOST
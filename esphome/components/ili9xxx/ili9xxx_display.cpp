@@ -161,7 +161,9 @@ void ILI9XXXDisplay::update() {
     this->do_update_();
   } while (this->need_update_);
   this->prossing_update_ = false;
+  const uint32_t flush_start = micros();
   this->display_();
+  this->record_flush_time_(flush_start);
 }
 
 void ILI9XXXDisplay::display_() {
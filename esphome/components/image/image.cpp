@@ -6,10 +6,14 @@ namespace esphome {
 namespace image {
 
 void Image::draw(int x, int y, display::Display *display, Color color_on, Color color_off) {
+  this->draw_region_(x, y, display, color_on, color_off, 0, 0, this->width_, this->height_);
+}
+void Image::draw_region_(int x, int y, display::Display *display, Color color_on, Color color_off, int region_x,
+                         int region_y, int region_w, int region_h) {
   switch (type_) {
     case IMAGE_TYPE_BINARY: {
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_x = region_x; img_x < region_x + region_w; img_x++) {
+        for (int img_y = region_y; img_y < region_y + region_h; img_y++) {
           if (this->get_binary_pixel_(img_x, img_y)) {
             display->draw_pixel_at(x + img_x, y + img_y, color_on);
           } else if (!this->transparent_) {
@@ -20,8 +24,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       break;
     }
     case IMAGE_TYPE_GRAYSCALE:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_x = region_x; img_x < region_x + region_w; img_x++) {
+        for (int img_y = region_y; img_y < region_y + region_h; img_y++) {
           auto color = this->get_grayscale_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -30,8 +34,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB565:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_x = region_x; img_x < region_x + region_w; img_x++) {
+        for (int img_y = region_y; img_y < region_y + region_h; img_y++) {
           auto color = this->get_rgb565_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -40,8 +44,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGB24:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_x = region_x; img_x < region_x + region_w; img_x++) {
+        for (int img_y = region_y; img_y < region_y + region_h; img_y++) {
           auto color = this->get_rgb24_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -50,8 +54,8 @@ void Image::draw(int x, int y, display::Display *display, Color color_on, Color
       }
       break;
     case IMAGE_TYPE_RGBA:
-      for (int img_x = 0; img_x < width_; img_x++) {
-        for (int img_y = 0; img_y < height_; img_y++) {
+      for (int img_x = region_x; img_x < region_x + region_w; img_x++) {
+        for (int img_y = region_y; img_y < region_y + region_h; img_y++) {
           auto color = this->get_rgba_pixel_(img_x, img_y);
           if (color.w >= 0x80) {
             display->draw_pixel_at(x + img_x, y + img_y, color);
@@ -45,6 +45,9 @@ class Image : public display::BaseImage {
   bool has_transparency() const { return transparent_; }
 
  protected:
+  /// Draw only the part of the image inside the given region (in image coordinates) at [x,y].
+  void draw_region_(int x, int y, display::Display *display, Color color_on, Color color_off, int region_x,
+                    int region_y, int region_w, int region_h);
   bool get_binary_pixel_(int x, int y) const;
   Color get_rgb24_pixel_(int x, int y) const;
   Color get_rgba_pixel_(int x, int y) const;
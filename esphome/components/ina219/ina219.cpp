@@ -148,6 +148,11 @@ void INA219Component::dump_config() {
 float INA219Component::get_setup_priority() const { return setup_priority::DATA; }
 
 void INA219Component::update() {
+  // Read the registers from the loop of the bus, together with the other devices on it
+  this->schedule_transaction(0, [this]() { this->read_data_(); });
+}
+
+void INA219Component::read_data_() {
   if (this->bus_voltage_sensor_ != nullptr) {
     uint16_t raw_bus_voltage;
     if (!this->read_byte_16(INA219_REGISTER_BUS_VOLTAGE, &raw_bus_voltage)) {
@@ -25,6 +25,8 @@ class INA219Component : public PollingComponent, public i2c::I2CDevice {
   void set_power_sensor(sensor::Sensor *power_sensor) { power_sensor_ = power_sensor; }
 
  protected:
+  void read_data_();
+
   float shunt_resistance_ohm_;
   float max_current_a_;
   float max_voltage_v_;
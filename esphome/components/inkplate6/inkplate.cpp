@@ -1,5 +1,6 @@
 #include "inkplate.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 
@@ -146,7 +147,9 @@ void Inkplate6::update() {
     this->block_partial_ = true;
   }
 
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 
 void HOT Inkplate6::draw_absolute_pixel_internal(int x, int y, Color color) {
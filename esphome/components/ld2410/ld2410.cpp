@@ -111,8 +111,11 @@ void LD2410Component::loop() {
   const int max_line_length = 80;
   static uint8_t buffer[max_line_length];
 
-  while (available()) {
-    this->readline_(read(), buffer, max_line_length);
+  const uint8_t *data;
+  while (size_t len = this->peek_span(&data)) {
+    for (size_t i = 0; i < len; i++)
+      this->readline_(data[i], buffer, max_line_length);
+    this->consume(len);
   }
 }
 
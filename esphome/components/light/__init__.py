@@ -19,7 +19,7 @@ from esphome.const import (
     CONF_COLD_WHITE_COLOR_TEMPERATURE,
     CONF_WARM_WHITE_COLOR_TEMPERATURE,
 )
-from esphome.core import coroutine_with_priority
+from esphome.core import CORE, ID, coroutine_with_priority
 from esphome.cpp_helpers import setup_entity
 from .automation import light_control_to_code  # noqa
 from .effects import (
@@ -36,6 +36,7 @@ from .types import (  # noqa
     light_ns,
     LightOutput,
     AddressableLight,
+    AddressableLightFrameGroup,
     LightTurnOnTrigger,
     LightTurnOffTrigger,
     LightStateTrigger,
@@ -44,6 +45,9 @@ from .types import (  # noqa
 CODEOWNERS = ["@esphome/core"]
 IS_PLATFORM_COMPONENT = True
 
+CONF_FIXED_POINT_TRANSITIONS = "fixed_point_transitions"
+CONF_FRAME_GROUP = "frame_group"
+
 LightRestoreMode = light_ns.enum("LightRestoreMode")
 RESTORE_MODES = {
     "RESTORE_DEFAULT_OFF": LightRestoreMode.LIGHT_RESTORE_DEFAULT_OFF,
@@ -90,6 +94,7 @@ BINARY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend(
 BRIGHTNESS_ONLY_LIGHT_SCHEMA = LIGHT_SCHEMA.extend(
     {
         cv.Optional(CONF_GAMMA_CORRECT, default=2.8): cv.positive_float,
+        cv.Optional(CONF_FIXED_POINT_TRANSITIONS): cv.boolean,
         cv.Optional(
             CONF_DEFAULT_TRANSITION_LENGTH, default="1s"
         ): cv.positive_time_period_milliseconds,
@@ -114,6 +119,9 @@ ADDRESSABLE_LIGHT_SCHEMA = RGB_LIGHT_SCHEMA.extend(
             [cv.percentage], cv.Length(min=3, max=4)
         ),
         cv.Optional(CONF_POWER_SUPPLY): cv.use_id(power_supply.PowerSupply),
+        cv.Optional(CONF_FIXED_POINT_TRANSITIONS): cv.invalid(
+            "Addressable lights have their own transitions and color correction"
+        ),
     }
 )
 
@@ -149,6 +157,8 @@ async def setup_light_core_(light_var, output_var, config):
         )
     if CONF_GAMMA_CORRECT in config:
         cg.add(light_var.set_gamma_correct(config[CONF_GAMMA_CORRECT]))
+    if config.get(CONF_FIXED_POINT_TRANSITIONS, False):
+        cg.add(light_var.set_fixed_point_transitions(True))
     effects = await cg.build_registry_list(
         EFFECTS_REGISTRY, config.get(CONF_EFFECTS, [])
     )
@@ -183,6 +193,23 @@ async def register_light(output_var, config):
     await setup_light_core_(light_var, output_var, config)
 
 
+def add_to_frame_group(output_var, name, min_frame_interval=None):
+    """Show the frames of an addressable light output together with all other outputs naming the same group.
+
+    The output must implement send_frame_() and call request_group_frame_() from write_state() when it is in a group.
+    """
+    groups = CORE.data.setdefault("light", {}).setdefault(CONF_FRAME_GROUP, {})
+    if name not in groups:
+        group_id = ID(
+            f"frame_group_{name}", is_declaration=True, type=AddressableLightFrameGroup
+        )
+        groups[name] = cg.new_Pvariable(group_id)
+    group = groups[name]
+    cg.add(output_var.set_frame_group(group))
+    if min_frame_interval is not None:
+        cg.add(group.set_min_frame_interval(min_frame_interval))
+
+
 @coroutine_with_priority(100.0)
 async def to_code(config):
     cg.add_define("USE_LIGHT")
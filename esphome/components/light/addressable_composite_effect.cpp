@@ -0,0 +1,105 @@
+#include "addressable_composite_effect.h"
+#include "esphome/core/helpers.h"
+#include "esphome/core/log.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace light {
+
+static const char *const TAG = "light.composite";
+
+AddressableLightLayer::AddressableLightLayer(LightState *state, uint8_t *data, uint8_t *effect_data, int32_t size)
+    : data_(data), effect_data_(effect_data), size_(size) {
+  this->state_parent_ = state;
+  // Layers hold plain colors; brightness and gamma are applied once, when the layers are blended into the output
+  this->correction_.calculate_gamma_table(1.0f);
+}
+
+void AddressableLightLayer::clear_effect_data() { memset(this->effect_data_, 0, this->size_); }
+
+void AddressableLightLayer::clear() { memset(this->data_, 0, this->size_ * 4); }
+
+static inline Color blend(const Color &below, Color layer, BlendMode blend_mode, uint8_t opacity) {
+  switch (blend_mode) {
+    case BLEND_MODE_ADD:
+      return below + layer * opacity;
+    case BLEND_MODE_ALPHA:
+      if (layer.raw_32 == 0)
+        return below;
+      return below * uint8_t(255 - opacity) + layer * opacity;
+    case BLEND_MODE_MAX:
+      layer *= opacity;
+      return Color(std::max(below.r, layer.r), std::max(below.g, layer.g), std::max(below.b, layer.b),
+                   std::max(below.w, layer.w));
+    case BLEND_MODE_MASK:
+      return below * layer;
+  }
+  return below;
+}
+
+void AddressableCompositeEffect::init() {
+  for (auto &layer : this->layers_)
+    layer.effect->init_internal(this->state_);
+}
+
+bool AddressableCompositeEffect::allocate_layers_() {
+  if (this->arena_ != nullptr)
+    return true;
+
+  // One block for all layers: RGBW values of every layer, followed by the effect data of every layer
+  const int32_t size = this->get_addressable_()->size();
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  this->arena_ = allocator.allocate(this->layers_.size() * size * 5);
+  if (this->arena_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate layers for '%s'", this->name_.c_str());
+    return false;
+  }
+
+  uint8_t *effect_data = this->arena_ + this->layers_.size() * size * 4;
+  for (size_t i = 0; i < this->layers_.size(); i++) {
+    auto &layer = this->layers_[i];
+    layer.output = new AddressableLightLayer(this->state_, this->arena_ + i * size * 4,  // NOLINT
+                                             effect_data + i * size, size);
+    layer.effect->set_output(layer.output);
+  }
+  return true;
+}
+
+void AddressableCompositeEffect::start() {
+  if (!this->allocate_layers_())
+    return;
+
+  for (auto &layer : this->layers_) {
+    layer.output->clear();
+    layer.effect->start_internal();
+  }
+}
+
+void AddressableCompositeEffect::stop() {
+  if (this->arena_ != nullptr) {
+    for (auto &layer : this->layers_)
+      layer.effect->stop();
+  }
+  AddressableLightEffect::stop();
+}
+
+void AddressableCompositeEffect::apply(AddressableLight &it, const Color &current_color) {
+  if (this->arena_ == nullptr)
+    return;
+
+  for (auto &layer : this->layers_)
+    layer.effect->apply(*layer.output, current_color);
+
+  for (int32_t i = 0; i < it.size(); i++) {
+    Color color;
+    for (auto &layer : this->layers_)
+      color = blend(color, layer.output->get_color(i), layer.blend_mode, layer.opacity);
+    it[i] = color;
+  }
+  it.schedule_show();
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <vector>
+
+#include "addressable_light_effect.h"
+
+namespace esphome {
+namespace light {
+
+enum BlendMode : uint8_t {
+  /// Add the layer on top of the layers below.
+  BLEND_MODE_ADD,
+  /// Mix the layer with the layers below by its opacity; black LEDs of the layer are transparent.
+  BLEND_MODE_ALPHA,
+  /// Take the brighter value of each channel.
+  BLEND_MODE_MAX,
+  /// Scale the layers below by the layer, channel by channel.
+  BLEND_MODE_MASK,
+};
+
+/// Off-screen addressable light that an effect of a composite effect renders into.
+class AddressableLightLayer : public AddressableLight {
+ public:
+  AddressableLightLayer(LightState *state, uint8_t *data, uint8_t *effect_data, int32_t size);
+
+  int32_t size() const override { return this->size_; }
+  void clear_effect_data() override;
+  LightTraits get_traits() override { return this->state_parent_->get_traits(); }
+  void write_state(LightState *state) override {}
+
+  /// Clear all LEDs to black.
+  void clear();
+  Color get_color(int32_t index) const {
+    const uint8_t *led = this->data_ + index * 4;
+    return Color(led[0], led[1], led[2], led[3]);
+  }
+
+ protected:
+  ESPColorView get_view_internal(int32_t index) const override {
+    uint8_t *led = this->data_ + index * 4;
+    return {led, led + 1, led + 2, led + 3, this->effect_data_ + index, &this->correction_};
+  }
+  ESPColorSpan get_span_internal() const override { return {this->data_, this->size_, 4, 0, 1, 2, 3}; }
+
+  uint8_t *data_;
+  uint8_t *effect_data_;
+  int32_t size_;
+};
+
+/** Runs several addressable effects at once and blends their output.
+ *
+ * Every layer renders into its own off-screen buffer; these are allocated together the first time the effect
+ * starts and kept afterwards. Each time the effect is applied, the layers are blended bottom to top in a single
+ * pass over the LEDs and the result is written to the light, with color correction applied only there.
+ */
+class AddressableCompositeEffect : public AddressableLightEffect {
+ public:
+  explicit AddressableCompositeEffect(const std::string &name) : AddressableLightEffect(name) {}
+
+  void add_layer(AddressableLightEffect *effect, BlendMode blend_mode, float opacity) {
+    this->layers_.push_back({effect, blend_mode, to_uint8_scale(opacity), nullptr});
+  }
+
+  void init() override;
+  void start() override;
+  void stop() override;
+  void apply(AddressableLight &it, const Color &current_color) override;
+
+ protected:
+  struct Layer {
+    AddressableLightEffect *effect;
+    BlendMode blend_mode;
+    uint8_t opacity;
+    AddressableLightLayer *output;
+  };
+
+  bool allocate_layers_();
+
+  std::vector<Layer> layers_;
+  uint8_t *arena_{nullptr};
+};
+
+}  // namespace light
+}  // namespace esphome
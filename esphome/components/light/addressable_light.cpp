@@ -1,6 +1,8 @@
 #include "addressable_light.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace light {
 
@@ -9,6 +11,26 @@ static const char *const TAG = "light.addressable";
 void AddressableLight::call_setup() {
   this->setup();
 
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  this->enable_frame_stats();
+#endif
+  if (this->frame_stats_) {
+    this->set_interval("frame_rate", 1000, [this]() {
+      this->frame_rate_ = this->frames_this_second_;
+      this->frames_this_second_ = 0;
+    });
+  }
+
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  this->set_interval("frame_stats", 10000, [this]() {
+    if (this->frame_rate_ == 0)
+      return;
+    const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
+    ESP_LOGV(TAG, "Addressable Light '%s': %" PRIu32 " frames/s, %" PRIu32 " dropped frames", name, this->frame_rate_,
+             this->dropped_frames_);
+  });
+#endif
+
 #ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
   this->set_interval(5000, [this]() {
     const char *name = this->state_parent_ == nullptr ? "" : this->state_parent_->get_name().c_str();
@@ -23,6 +45,24 @@ void AddressableLight::call_setup() {
 #endif
 }
 
+void AddressableLight::request_group_frame_() {
+  this->frame_pending_ = true;
+  if (this->frame_group_->show_scheduled_)
+    return;
+  // Let the other members update their buffers in this loop iteration before the group starts the frame
+  this->frame_group_->show_scheduled_ = true;
+  this->defer("frame_group", [this]() { this->frame_group_->show(); });
+}
+
+uint32_t AddressableLight::frame_checksum_(const uint8_t *buf, size_t len) {
+  uint32_t hash = 2166136261UL;
+  for (size_t i = 0; i < len; i++) {
+    hash ^= buf[i];
+    hash *= 16777619UL;
+  }
+  return hash;
+}
+
 std::unique_ptr<LightTransformer> AddressableLight::create_default_transition() {
   return make_unique<AddressableLightTransformer>(*this);
 }
@@ -95,13 +135,8 @@ optional<LightColorValues> AddressableLightTransformer::apply() {
   alpha255 = clamp(alpha255, 0.0f, 255.0f);
   auto alpha8 = static_cast<uint8_t>(alpha255);
 
-  if (alpha8 != 0) {
-    uint8_t inv_alpha8 = 255 - alpha8;
-    Color add = this->target_color_ * alpha8;
-
-    for (auto led : this->light_)
-      led.set(add + led.get() * inv_alpha8);
-  }
+  if (alpha8 != 0)
+    this->light_.all().blend_toward(this->target_color_, alpha8);
 
   this->last_transition_progress_ = smoothed_progress;
   this->light_.schedule_show();
@@ -3,7 +3,9 @@
 #include "esphome/core/component.h"
 #include "esphome/core/defines.h"
 #include "esphome/core/color.h"
+#include "addressable_light_frame_group.h"
 #include "esp_color_correction.h"
+#include "esp_color_span.h"
 #include "esp_color_view.h"
 #include "esp_range_view.h"
 #include "light_output.h"
@@ -40,6 +42,9 @@ class AddressableLight : public LightOutput, public Component {
     return ESPRangeView(this, from, to);
   }
   ESPRangeView all() { return ESPRangeView(this, 0, this->size()); }
+  /// The raw output buffer for bulk operations, or an invalid span if the light doesn't store its LEDs that way.
+  ESPColorSpan span() const { return this->get_span_internal(); }
+  const ESPColorCorrection &get_correction() const { return this->correction_; }
   ESPRangeIterator begin() { return this->all().begin(); }
   ESPRangeIterator end() { return this->all().end(); }
   void shift_left(int32_t amnt) {
@@ -75,6 +80,19 @@ class AddressableLight : public LightOutput, public Component {
   void update_state(LightState *state) override;
   void schedule_show() { this->state_parent_->next_write_ = true; }
 
+  /// Show frames together with the other lights of `frame_group` instead of on this light's own schedule.
+  void set_frame_group(AddressableLightFrameGroup *frame_group) {
+    this->frame_group_ = frame_group;
+    frame_group->add_light(this);
+  }
+
+  /// Measure the frame rate, for diagnostics; verbose logging turns this on as well. Call before setup.
+  void enable_frame_stats() { this->frame_stats_ = true; }
+  /// Frames per second actually sent to the LEDs during the last second, 0 unless frame stats are enabled.
+  uint32_t get_frame_rate() const { return this->frame_rate_; }
+  /// Number of frames that were never sent because a newer frame replaced them while the output was still busy.
+  uint32_t get_dropped_frames() const { return this->dropped_frames_; }
+
 #ifdef USE_POWER_SUPPLY
   void set_power_supply(power_supply::PowerSupply *power_supply) { this->power_.set_parent(power_supply); }
 #endif
@@ -83,6 +101,7 @@ class AddressableLight : public LightOutput, public Component {
 
  protected:
   friend class AddressableLightTransformer;
+  friend class AddressableLightFrameGroup;
 
   void mark_shown_() {
 #ifdef USE_POWER_SUPPLY
@@ -97,12 +116,63 @@ class AddressableLight : public LightOutput, public Component {
   }
   virtual ESPColorView get_view_internal(int32_t index) const = 0;
 
+  /// Outputs that send asynchronously report whether the previous frame is still being sent.
+  virtual bool is_sending_() { return false; }
+  /// Send the current buffer. Outputs supporting frame groups implement this and call it from write_state(), unless
+  /// they're part of a group: then write_state() calls request_group_frame_() and the group sends the frame.
+  virtual void send_frame_() {}
+  void request_group_frame_();
+
+  /// Checksum of the raw output buffer, to tell whether a frame changes anything since the last one shown.
+  static uint32_t frame_checksum_(const uint8_t *buf, size_t len);
+  /// Checksum of the current frame, for outputs that can defer frames.
+  virtual uint32_t get_frame_checksum_() { return 0; }
+  bool is_frame_unchanged_(uint32_t checksum) const {
+    return this->has_shown_frame_ && checksum == this->shown_frame_checksum_;
+  }
+  /// Record that a frame was handed to the hardware.
+  void record_frame_shown_() {
+    this->has_deferred_frame_ = false;
+    this->frames_this_second_++;
+  }
+  /// Record that a frame with the given checksum was handed to the hardware, for outputs that skip unchanged frames.
+  void record_frame_shown_(uint32_t checksum) {
+    this->has_shown_frame_ = true;
+    this->shown_frame_checksum_ = checksum;
+    this->record_frame_shown_();
+  }
+  /// Record that a frame wasn't sent because it's the same as the last one shown.
+  void record_frame_skipped_() { this->has_deferred_frame_ = false; }
+  /** The output can't take the current frame right now; try again next loop iteration.
+   *
+   * A deferred frame that changes before it could be sent counts as dropped, once.
+   */
+  void record_frame_deferred_() {
+    const uint32_t checksum = this->get_frame_checksum_();
+    if (this->has_deferred_frame_ && checksum != this->deferred_frame_checksum_)
+      this->dropped_frames_++;
+    this->has_deferred_frame_ = true;
+    this->deferred_frame_checksum_ = checksum;
+    this->schedule_show();
+  }
+  virtual ESPColorSpan get_span_internal() const { return {}; }
+
   bool effect_active_{false};
   ESPColorCorrection correction_{};
 #ifdef USE_POWER_SUPPLY
   power_supply::PowerSupplyRequester power_;
 #endif
   LightState *state_parent_{nullptr};
+  AddressableLightFrameGroup *frame_group_{nullptr};
+  bool frame_pending_{false};
+  bool frame_stats_{false};
+  bool has_shown_frame_{false};
+  bool has_deferred_frame_{false};
+  uint32_t shown_frame_checksum_{0};
+  uint32_t deferred_frame_checksum_{0};
+  uint32_t frames_this_second_{0};
+  uint32_t frame_rate_{0};
+  uint32_t dropped_frames_{0};
 };
 
 class AddressableLightTransformer : public LightTransitionTransformer {
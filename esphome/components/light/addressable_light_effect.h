@@ -43,9 +43,17 @@ class AddressableLightEffect : public LightEffect {
     Color current_color = color_from_light_color_values(this->state_->remote_values);
     this->apply(*this->get_addressable_(), current_color);
   }
+  /// Render into the given light instead of the output of the light state, e.g. a layer of a composite effect.
+  void set_output(AddressableLight *output) { this->output_ = output; }
 
  protected:
-  AddressableLight *get_addressable_() const { return (AddressableLight *) this->state_->get_output(); }
+  AddressableLight *get_addressable_() const {
+    if (this->output_ != nullptr)
+      return this->output_;
+    return (AddressableLight *) this->state_->get_output();
+  }
+
+  AddressableLight *output_{nullptr};
 };
 
 class AddressableLambdaLightEffect : public AddressableLightEffect {
@@ -327,7 +335,6 @@ class AddressableFlickerEffect : public AddressableLightEffect {
   void apply(AddressableLight &it, const Color &current_color) override {
     const uint32_t now = millis();
     const uint8_t intensity = this->intensity_;
-    const uint8_t inv_intensity = 255 - intensity;
     if (now - this->last_update_ < this->update_interval_)
       return;
 
@@ -338,10 +345,9 @@ class AddressableFlickerEffect : public AddressableLightEffect {
       const uint8_t flicker = (rng_state & 0xFF) % intensity;
       // scale down by random factor
       var = var.get() * (255 - flicker);
-
-      // slowly fade back to "real" value
-      var = (var.get() * inv_intensity) + (current_color * intensity);
     }
+    // slowly fade back to "real" value
+    it.all().blend_toward(current_color, intensity);
     it.schedule_show();
   }
   void set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
@@ -0,0 +1,41 @@
+#include "addressable_light_frame_group.h"
+#include "addressable_light.h"
+#include "esphome/core/hal.h"
+
+namespace esphome {
+namespace light {
+
+void AddressableLightFrameGroup::show() {
+  this->show_scheduled_ = false;
+  uint32_t now = micros();
+  if (now - this->last_frame_ < this->min_frame_interval_us_) {
+    for (auto *light : this->lights_) {
+      if (light->frame_pending_)
+        light->schedule_show();
+    }
+    return;
+  }
+
+  // Frame barrier: don't start anything until every member is done with the previous frame
+  for (auto *light : this->lights_) {
+    if (light->is_sending_()) {
+      for (auto *pending : this->lights_) {
+        if (pending->frame_pending_)
+          pending->record_frame_deferred_();
+      }
+      return;
+    }
+  }
+
+  this->last_frame_ = now;
+  this->frame_count_++;
+  for (auto *light : this->lights_) {
+    if (!light->frame_pending_)
+      continue;
+    light->frame_pending_ = false;
+    light->send_frame_();
+  }
+}
+
+}  // namespace light
+}  // namespace esphome
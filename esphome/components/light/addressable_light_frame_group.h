@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace esphome {
+namespace light {
+
+class AddressableLight;
+
+/** Shows the frames of several addressable lights together.
+ *
+ * Members don't send frames on their own. A frame starts once the frame interval has passed and none of the
+ * members is still sending the previous one; every member with new data then starts sending in the same main loop
+ * iteration, so outputs on separate channels transmit in parallel.
+ */
+class AddressableLightFrameGroup {
+ public:
+  void add_light(AddressableLight *light) { this->lights_.push_back(light); }
+  /// Minimum time between the start of two frames; the longest interval requested by any member wins.
+  void set_min_frame_interval(uint32_t interval_us) {
+    this->min_frame_interval_us_ = std::max(this->min_frame_interval_us_, interval_us);
+  }
+
+  /// Start sending all pending frames if the group is ready, otherwise try again next loop iteration.
+  void show();
+  /// Number of frames the group started.
+  uint32_t get_frame_count() const { return this->frame_count_; }
+
+ protected:
+  friend class AddressableLight;
+
+  std::vector<AddressableLight *> lights_;
+  uint32_t min_frame_interval_us_{0};
+  uint32_t last_frame_{0};
+  uint32_t frame_count_{0};
+  /// A member already deferred show() for the pending frame.
+  bool show_scheduled_{false};
+};
+
+}  // namespace light
+}  // namespace esphome
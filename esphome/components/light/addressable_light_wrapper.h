@@ -110,6 +110,7 @@ class AddressableLightWrapper : public light::AddressableLight {
     call.perform();
 
     this->mark_shown_();
+    this->record_frame_shown_();
   }
 
  protected:
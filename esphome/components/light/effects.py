@@ -30,6 +30,8 @@ from esphome.const import (
     CONF_SEQUENCE,
     CONF_MAX_BRIGHTNESS,
     CONF_MIN_BRIGHTNESS,
+    CONF_EFFECT,
+    CONF_TYPE_ID,
 )
 from esphome.util import Registry
 from .types import (
@@ -52,6 +54,8 @@ from .types import (
     AddressableRandomTwinkleEffect,
     AddressableFireworksEffect,
     AddressableFlickerEffect,
+    AddressableCompositeEffect,
+    BLEND_MODES,
     AutomationLightEffect,
     Color,
 )
@@ -75,6 +79,10 @@ CONF_ADDRESSABLE_TWINKLE = "addressable_twinkle"
 CONF_ADDRESSABLE_RANDOM_TWINKLE = "addressable_random_twinkle"
 CONF_ADDRESSABLE_FIREWORKS = "addressable_fireworks"
 CONF_ADDRESSABLE_FLICKER = "addressable_flicker"
+CONF_ADDRESSABLE_COMPOSITE = "addressable_composite"
+CONF_LAYERS = "layers"
+CONF_BLEND_MODE = "blend_mode"
+CONF_OPACITY = "opacity"
 CONF_AUTOMATION = "automation"
 CONF_ON_LENGTH = "on_length"
 CONF_OFF_LENGTH = "off_length"
@@ -331,6 +339,45 @@ async def flicker_effect_to_code(config, effect_id):
     return var
 
 
+def validate_layer_effect(value):
+    value = cv.validate_registry_entry("effect", EFFECTS_REGISTRY)(value)
+    key = next(it for it in value.keys() if it != CONF_TYPE_ID)
+    if (
+        key not in ADDRESSABLE_EFFECTS
+        or key in RGB_EFFECTS
+        or key == CONF_ADDRESSABLE_COMPOSITE
+    ):
+        raise cv.Invalid(f"The effect '{key}' can't be used as a layer", [key])
+    return value
+
+
+LAYER_SCHEMA = cv.Schema(
+    {
+        cv.Required(CONF_EFFECT): validate_layer_effect,
+        cv.Optional(CONF_BLEND_MODE, default="ADD"): cv.enum(BLEND_MODES, upper=True),
+        cv.Optional(CONF_OPACITY, default="100%"): cv.percentage,
+    }
+)
+
+
+@register_addressable_effect(
+    CONF_ADDRESSABLE_COMPOSITE,
+    AddressableCompositeEffect,
+    "Composite",
+    {
+        cv.Required(CONF_LAYERS): cv.All(
+            cv.ensure_list(LAYER_SCHEMA), cv.Length(min=1)
+        ),
+    },
+)
+async def addressable_composite_effect_to_code(config, effect_id):
+    var = cg.new_Pvariable(effect_id, config[CONF_NAME])
+    for layer in config[CONF_LAYERS]:
+        effect = await cg.build_registry_entry(EFFECTS_REGISTRY, layer[CONF_EFFECT])
+        cg.add(var.add_layer(effect, layer[CONF_BLEND_MODE], layer[CONF_OPACITY]))
+    return var
+
+
 @register_addressable_effect(
     "addressable_lambda",
     AddressableLambdaLightEffect,
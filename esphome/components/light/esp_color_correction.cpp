@@ -2,6 +2,8 @@
 #include "light_color_values.h"
 #include "esphome/core/log.h"
 
+#include <cstring>
+
 namespace esphome {
 namespace light {
 
@@ -14,13 +16,42 @@ void ESPColorCorrection::calculate_gamma_table(float gamma) {
   if (gamma == 0.0f) {
     for (uint16_t i = 0; i < 256; i++)
       this->gamma_reverse_table_[i] = i;
-    return;
+  } else {
+    for (uint16_t i = 0; i < 256; i++) {
+      // val = corrected ^ (1/gamma)
+      auto uncorrected = to_uint8_scale(powf(i / 255.0f, 1.0f / gamma));
+      this->gamma_reverse_table_[i] = uncorrected;
+    }
   }
-  for (uint16_t i = 0; i < 256; i++) {
-    // val = corrected ^ (1/gamma)
-    auto uncorrected = to_uint8_scale(powf(i / 255.0f, 1.0f / gamma));
-    this->gamma_reverse_table_[i] = uncorrected;
+  this->invalidate_tables_();
+}
+
+void ESPColorCorrection::calculate_correct_tables_() const {
+  for (uint8_t channel = 0; channel < 4; channel++) {
+    const uint8_t max_brightness = this->max_brightness_.raw[channel];
+    for (uint16_t i = 0; i < 256; i++) {
+      uint8_t scaled = esp_scale8(esp_scale8(i, max_brightness), this->local_brightness_);
+      this->correct_table_[channel][i] = this->gamma_table_[scaled];
+    }
+  }
+  this->correct_dirty_ = false;
+}
+
+void ESPColorCorrection::calculate_uncorrect_tables_() const {
+  for (uint8_t channel = 0; channel < 4; channel++) {
+    const uint8_t max_brightness = this->max_brightness_.raw[channel];
+    if (max_brightness == 0 || this->local_brightness_ == 0) {
+      memset(this->uncorrect_table_[channel], 0, sizeof(this->uncorrect_table_[channel]));
+      continue;
+    }
+    for (uint16_t i = 0; i < 256; i++) {
+      uint16_t uncorrected = this->gamma_reverse_table_[i] * 255UL;
+      // Truncated to 8 bits like the per-channel division it replaces
+      uint8_t res = ((uncorrected / max_brightness) * 255UL) / this->local_brightness_;
+      this->uncorrect_table_[channel][i] = res;
+    }
   }
+  this->uncorrect_dirty_ = false;
 }
 
 }  // namespace light
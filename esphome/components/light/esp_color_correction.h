@@ -8,67 +8,80 @@ namespace light {
 class ESPColorCorrection {
  public:
   ESPColorCorrection() : max_brightness_(255, 255, 255, 255) {}
-  void set_max_brightness(const Color &max_brightness) { this->max_brightness_ = max_brightness; }
-  void set_local_brightness(uint8_t local_brightness) { this->local_brightness_ = local_brightness; }
+  void set_max_brightness(const Color &max_brightness) {
+    if (this->max_brightness_ == max_brightness)
+      return;
+    this->max_brightness_ = max_brightness;
+    this->invalidate_tables_();
+  }
+  void set_local_brightness(uint8_t local_brightness) {
+    if (this->local_brightness_ == local_brightness)
+      return;
+    this->local_brightness_ = local_brightness;
+    this->invalidate_tables_();
+  }
   void calculate_gamma_table(float gamma);
   inline Color color_correct(Color color) const ALWAYS_INLINE {
     // corrected = (uncorrected * max_brightness * local_brightness) ^ gamma
-    return Color(this->color_correct_red(color.red), this->color_correct_green(color.green),
-                 this->color_correct_blue(color.blue), this->color_correct_white(color.white));
-  }
-  inline uint8_t color_correct_red(uint8_t red) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(red, this->max_brightness_.red), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
-  inline uint8_t color_correct_green(uint8_t green) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(green, this->max_brightness_.green), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
-  inline uint8_t color_correct_blue(uint8_t blue) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(blue, this->max_brightness_.blue), this->local_brightness_);
-    return this->gamma_table_[res];
-  }
-  inline uint8_t color_correct_white(uint8_t white) const ALWAYS_INLINE {
-    uint8_t res = esp_scale8(esp_scale8(white, this->max_brightness_.white), this->local_brightness_);
-    return this->gamma_table_[res];
+    if (this->correct_dirty_)
+      this->calculate_correct_tables_();
+    return Color(this->correct_table_[0][color.red], this->correct_table_[1][color.green],
+                 this->correct_table_[2][color.blue], this->correct_table_[3][color.white]);
   }
+  inline uint8_t color_correct_red(uint8_t red) const ALWAYS_INLINE { return this->correct_(0, red); }
+  inline uint8_t color_correct_green(uint8_t green) const ALWAYS_INLINE { return this->correct_(1, green); }
+  inline uint8_t color_correct_blue(uint8_t blue) const ALWAYS_INLINE { return this->correct_(2, blue); }
+  inline uint8_t color_correct_white(uint8_t white) const ALWAYS_INLINE { return this->correct_(3, white); }
   inline Color color_uncorrect(Color color) const ALWAYS_INLINE {
     // uncorrected = corrected^(1/gamma) / (max_brightness * local_brightness)
-    return Color(this->color_uncorrect_red(color.red), this->color_uncorrect_green(color.green),
-                 this->color_uncorrect_blue(color.blue), this->color_uncorrect_white(color.white));
+    if (this->uncorrect_dirty_)
+      this->calculate_uncorrect_tables_();
+    return Color(this->uncorrect_table_[0][color.red], this->uncorrect_table_[1][color.green],
+                 this->uncorrect_table_[2][color.blue], this->uncorrect_table_[3][color.white]);
   }
-  inline uint8_t color_uncorrect_red(uint8_t red) const ALWAYS_INLINE {
-    if (this->max_brightness_.red == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[red] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.red) * 255UL) / this->local_brightness_;
-    return res;
+  inline uint8_t color_uncorrect_red(uint8_t red) const ALWAYS_INLINE { return this->uncorrect_(0, red); }
+  inline uint8_t color_uncorrect_green(uint8_t green) const ALWAYS_INLINE { return this->uncorrect_(1, green); }
+  inline uint8_t color_uncorrect_blue(uint8_t blue) const ALWAYS_INLINE { return this->uncorrect_(2, blue); }
+  inline uint8_t color_uncorrect_white(uint8_t white) const ALWAYS_INLINE { return this->uncorrect_(3, white); }
+  /// Lookup tables of one channel (0 red, 1 green, 2 blue, 3 white), valid until the next setter call.
+  const uint8_t *get_correct_table(uint8_t channel) const {
+    if (this->correct_dirty_)
+      this->calculate_correct_tables_();
+    return this->correct_table_[channel];
   }
-  inline uint8_t color_uncorrect_green(uint8_t green) const ALWAYS_INLINE {
-    if (this->max_brightness_.green == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[green] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.green) * 255UL) / this->local_brightness_;
-    return res;
+  const uint8_t *get_uncorrect_table(uint8_t channel) const {
+    if (this->uncorrect_dirty_)
+      this->calculate_uncorrect_tables_();
+    return this->uncorrect_table_[channel];
   }
-  inline uint8_t color_uncorrect_blue(uint8_t blue) const ALWAYS_INLINE {
-    if (this->max_brightness_.blue == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[blue] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.blue) * 255UL) / this->local_brightness_;
-    return res;
+
+ protected:
+  inline uint8_t correct_(uint8_t channel, uint8_t value) const ALWAYS_INLINE {
+    if (this->correct_dirty_)
+      this->calculate_correct_tables_();
+    return this->correct_table_[channel][value];
   }
-  inline uint8_t color_uncorrect_white(uint8_t white) const ALWAYS_INLINE {
-    if (this->max_brightness_.white == 0 || this->local_brightness_ == 0)
-      return 0;
-    uint16_t uncorrected = this->gamma_reverse_table_[white] * 255UL;
-    uint8_t res = ((uncorrected / this->max_brightness_.white) * 255UL) / this->local_brightness_;
-    return res;
+  inline uint8_t uncorrect_(uint8_t channel, uint8_t value) const ALWAYS_INLINE {
+    if (this->uncorrect_dirty_)
+      this->calculate_uncorrect_tables_();
+    return this->uncorrect_table_[channel][value];
   }
+  /// Mark both directions stale; each is rebuilt on its next lookup, so brightness changes between frames are cheap.
+  void invalidate_tables_() {
+    this->correct_dirty_ = true;
+    this->uncorrect_dirty_ = true;
+  }
+  /// Fold brightness and gamma into the per-channel tables of one direction.
+  void calculate_correct_tables_() const;
+  void calculate_uncorrect_tables_() const;
 
- protected:
   uint8_t gamma_table_[256];
   uint8_t gamma_reverse_table_[256];
+  // Per channel (red, green, blue, white), indexed by the uncorrected respectively corrected value
+  mutable uint8_t correct_table_[4][256];
+  mutable uint8_t uncorrect_table_[4][256];
+  mutable bool correct_dirty_{true};
+  mutable bool uncorrect_dirty_{true};
   Color max_brightness_;
   uint8_t local_brightness_{255};
 };
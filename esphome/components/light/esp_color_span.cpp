@@ -0,0 +1,124 @@
+#include "esp_color_span.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace esphome {
+namespace light {
+
+// Packed spans are processed a block at a time; 12 bytes hold a whole number of both RGB and RGBW LEDs.
+static const size_t BLOCK_SIZE = 12;
+
+// esp_scale8() on the four bytes of a word at once. Byte lanes are split into odd and even ones, so every product
+// has 8 bits of headroom and can't carry into its neighbour.
+static inline uint32_t scale_word(uint32_t word, uint16_t scale_plus_one) {
+  uint32_t even = (((word & 0x00FF00FFu) * scale_plus_one) >> 8) & 0x00FF00FFu;
+  uint32_t odd = (((word >> 8) & 0x00FF00FFu) * scale_plus_one) & 0xFF00FF00u;
+  return even | odd;
+}
+
+ESPColorSpan ESPColorSpan::subspan(int32_t begin, int32_t end) const {
+  ESPColorSpan span = *this;
+  span.data_ = this->data_ + begin * this->stride_;
+  span.size_ = end - begin;
+  return span;
+}
+
+void ESPColorSpan::pattern_(const Color &raw, uint8_t *pattern, size_t len) const {
+  for (size_t i = 0; i < len; i += this->stride_) {
+    for (uint8_t channel = 0; channel < 4; channel++) {
+      if (this->offsets_[channel] != NO_CHANNEL)
+        pattern[i + this->offsets_[channel]] = raw.raw[channel];
+    }
+  }
+}
+
+void ESPColorSpan::fill(const Color &raw) {
+  if (this->size_ <= 0)
+    return;
+
+  if (!this->is_packed_()) {
+    for (int32_t i = 0; i < this->size_; i++) {
+      uint8_t *led = this->data_ + i * this->stride_;
+      for (uint8_t channel = 0; channel < 4; channel++) {
+        if (this->offsets_[channel] != NO_CHANNEL)
+          led[this->offsets_[channel]] = raw.raw[channel];
+      }
+    }
+    return;
+  }
+
+  // Write the first LED, then keep doubling the filled part with block copies
+  const size_t len = this->size_ * this->stride_;
+  this->pattern_(raw, this->data_, this->stride_);
+  for (size_t filled = this->stride_; filled < len; filled *= 2)
+    memcpy(this->data_ + filled, this->data_, std::min(filled, len - filled));
+}
+
+void ESPColorSpan::blend_toward(const Color &raw, uint8_t alpha) {
+  const uint8_t inv_alpha = 255 - alpha;
+  const Color add = raw * alpha;
+
+  if (!this->is_blockwise_()) {
+    for (int32_t i = 0; i < this->size_; i++) {
+      uint8_t *led = this->data_ + i * this->stride_;
+      for (uint8_t channel = 0; channel < 4; channel++) {
+        if (this->offsets_[channel] != NO_CHANNEL) {
+          uint8_t &value = led[this->offsets_[channel]];
+          value = add.raw[channel] + esp_scale8(value, inv_alpha);
+        }
+      }
+    }
+    return;
+  }
+
+  // `add + value * inv_alpha` never exceeds 255, so the per-byte sums can't carry into the next lane either
+  uint32_t add_words[BLOCK_SIZE / sizeof(uint32_t)]{};
+  uint32_t mask_words[BLOCK_SIZE / sizeof(uint32_t)]{};
+  this->pattern_(add, reinterpret_cast<uint8_t *>(add_words), BLOCK_SIZE);
+  this->pattern_(Color::WHITE, reinterpret_cast<uint8_t *>(mask_words), BLOCK_SIZE);
+
+  uint8_t *data = this->data_;
+  size_t len = this->size_ * this->stride_;
+  for (; len >= BLOCK_SIZE; len -= BLOCK_SIZE, data += BLOCK_SIZE) {
+    uint32_t words[BLOCK_SIZE / sizeof(uint32_t)];
+    memcpy(words, data, BLOCK_SIZE);
+    for (size_t i = 0; i < BLOCK_SIZE / sizeof(uint32_t); i++) {
+      uint32_t blended = scale_word(words[i], inv_alpha + 1u) + add_words[i];
+      words[i] = (blended & mask_words[i]) | (words[i] & ~mask_words[i]);
+    }
+    memcpy(data, words, BLOCK_SIZE);
+  }
+  const uint8_t *add_bytes = reinterpret_cast<const uint8_t *>(add_words);
+  const uint8_t *mask_bytes = reinterpret_cast<const uint8_t *>(mask_words);
+  for (size_t i = 0; i < len; i++) {
+    if (mask_bytes[i] != 0)
+      data[i] = add_bytes[i] + esp_scale8(data[i], inv_alpha);
+  }
+}
+
+void ESPColorSpan::map(const uint8_t *const tables[4]) {
+  for (uint8_t channel = 0; channel < 4; channel++) {
+    const uint8_t *table = tables[channel];
+    if (table == nullptr || this->offsets_[channel] == NO_CHANNEL)
+      continue;
+    uint8_t *value = this->data_ + this->offsets_[channel];
+    for (int32_t i = 0; i < this->size_; i++, value += this->stride_)
+      *value = table[*value];
+  }
+}
+
+void ESPColorSpan::uncorrect(const ESPColorCorrection &correction) {
+  const uint8_t *const tables[4] = {correction.get_uncorrect_table(0), correction.get_uncorrect_table(1),
+                                    correction.get_uncorrect_table(2), correction.get_uncorrect_table(3)};
+  this->map(tables);
+}
+
+void ESPColorSpan::correct(const ESPColorCorrection &correction) {
+  const uint8_t *const tables[4] = {correction.get_correct_table(0), correction.get_correct_table(1),
+                                    correction.get_correct_table(2), correction.get_correct_table(3)};
+  this->map(tables);
+}
+
+}  // namespace light
+}  // namespace esphome
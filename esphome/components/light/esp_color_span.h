@@ -0,0 +1,55 @@
+#pragma once
+
+#include "esphome/core/color.h"
+#include "esp_color_correction.h"
+
+namespace esphome {
+namespace light {
+
+/** The raw output buffer of an addressable light, for operating on many LEDs at once.
+ *
+ * Values in the buffer are already color corrected, so operations on a span work in output space. LEDs are
+ * `stride` bytes apart and each channel sits at a fixed offset within a LED. With a stride of 3 or 4 bytes,
+ * blend_toward() processes whole words at once and leaves bytes that aren't channels (like the brightness byte of
+ * APA102 frames) untouched.
+ */
+class ESPColorSpan {
+ public:
+  static const uint8_t NO_CHANNEL = 0xFF;
+
+  ESPColorSpan() = default;
+  ESPColorSpan(uint8_t *data, int32_t size, uint8_t stride, uint8_t red, uint8_t green, uint8_t blue,
+               uint8_t white = NO_CHANNEL)
+      : data_(data), size_(size), stride_(stride), offsets_{red, green, blue, white} {}
+
+  /// Whether the light exposes its buffer at all.
+  bool is_valid() const { return this->data_ != nullptr; }
+  int32_t size() const { return this->size_; }
+  bool has_white() const { return this->offsets_[3] != NO_CHANNEL; }
+  /// Span of the half-open range of LEDs [begin, end).
+  ESPColorSpan subspan(int32_t begin, int32_t end) const;
+
+  /// Set all LEDs to the given raw (color corrected) color.
+  void fill(const Color &raw);
+  /// Blend all LEDs toward the given raw color, the same as `target * alpha + led * (255 - alpha)`.
+  void blend_toward(const Color &raw, uint8_t alpha);
+  /// Replace every channel value with `tables[channel][value]`; channels without a table are left unchanged.
+  void map(const uint8_t *const tables[4]);
+  /// Convert all LEDs from output to color space, and back.
+  void uncorrect(const ESPColorCorrection &correction);
+  void correct(const ESPColorCorrection &correction);
+
+ protected:
+  bool is_packed_() const { return this->stride_ == 3u + this->has_white(); }
+  /// Whether a block holds a whole number of LEDs, so the word kernels can run on it.
+  bool is_blockwise_() const { return this->stride_ == 3 || this->stride_ == 4; }
+  void pattern_(const Color &raw, uint8_t *pattern, size_t len) const;
+
+  uint8_t *data_{nullptr};
+  int32_t size_{0};
+  uint8_t stride_{3};
+  uint8_t offsets_[4]{0, 1, 2, NO_CHANNEL};
+};
+
+}  // namespace light
+}  // namespace esphome
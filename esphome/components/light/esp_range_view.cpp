@@ -4,6 +4,9 @@
 namespace esphome {
 namespace light {
 
+// Below this many LEDs, filling the lookup table of map_colors() costs more than converting each LED
+static const int32_t MAP_COLORS_MIN_SIZE = 128;
+
 int32_t HOT interpret_index(int32_t index, int32_t size) {
   if (index < 0)
     return size + index;
@@ -18,6 +21,11 @@ ESPRangeIterator ESPRangeView::begin() { return {*this, this->begin_}; }
 ESPRangeIterator ESPRangeView::end() { return {*this, this->end_}; }
 
 void ESPRangeView::set(const Color &color) {
+  ESPColorSpan span = this->parent_->span();
+  if (span.is_valid()) {
+    span.subspan(this->begin_, this->end_).fill(this->parent_->get_correction().color_correct(color));
+    return;
+  }
   for (int32_t i = this->begin_; i < this->end_; i++) {
     (*this->parent_)[i] = color;
   }
@@ -45,18 +53,26 @@ void ESPRangeView::set_effect_data(uint8_t effect_data) {
 }
 
 void ESPRangeView::fade_to_white(uint8_t amnt) {
+  if (this->map_colors([amnt](Color color) { return color.fade_to_white(amnt); }))
+    return;
   for (auto c : *this)
     c.fade_to_white(amnt);
 }
 void ESPRangeView::fade_to_black(uint8_t amnt) {
+  if (this->map_colors([amnt](Color color) { return color.fade_to_black(amnt); }))
+    return;
   for (auto c : *this)
     c.fade_to_black(amnt);
 }
 void ESPRangeView::lighten(uint8_t delta) {
+  if (this->map_colors([delta](Color color) { return color.lighten(delta); }))
+    return;
   for (auto c : *this)
     c.lighten(delta);
 }
 void ESPRangeView::darken(uint8_t delta) {
+  if (this->map_colors([delta](Color color) { return color.darken(delta); }))
+    return;
   for (auto c : *this)
     c.darken(delta);
 }
@@ -92,5 +108,46 @@ ESPRangeView &ESPRangeView::operator=(const ESPRangeView &rhs) {  // NOLINT
 
 ESPColorView ESPRangeIterator::operator*() const { return this->range_.parent_->get(this->i_); }
 
+ESPColorSpan ESPRangeView::uncorrected_span_() {
+  ESPColorSpan span = this->parent_->span();
+  if (!span.is_valid())
+    return span;
+  span = span.subspan(this->begin_, this->end_);
+  span.uncorrect(this->parent_->get_correction());
+  return span;
+}
+
+void ESPRangeView::blend_toward(const Color &color, uint8_t alpha) {
+  ESPColorSpan span = this->uncorrected_span_();
+  if (span.is_valid()) {
+    span.blend_toward(color, alpha);
+    span.correct(this->parent_->get_correction());
+    return;
+  }
+  const Color add = color * alpha;
+  const uint8_t inv_alpha = 255 - alpha;
+  for (auto led : *this)
+    led.set(add + led.get() * inv_alpha);
+}
+
+bool ESPRangeView::map_colors(const std::function<Color(Color)> &func) {
+  if (this->size() < MAP_COLORS_MIN_SIZE)
+    return false;
+  ESPColorSpan span = this->uncorrected_span_();
+  if (!span.is_valid())
+    return false;
+
+  // All channels go through the same function, so one table serves them. It lives outside the stack since effects
+  // run from the main loop only.
+  static uint8_t table[256];
+  for (int value = 0; value < 256; value++)
+    table[value] = func(Color(value, value, value, value)).red;
+
+  const uint8_t *const tables[4] = {table, table, table, table};
+  span.map(tables);
+  span.correct(this->parent_->get_correction());
+  return true;
+}
+
 }  // namespace light
 }  // namespace esphome
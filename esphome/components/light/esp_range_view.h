@@ -1,5 +1,8 @@
 #pragma once
 
+#include <functional>
+
+#include "esp_color_span.h"
 #include "esp_color_view.h"
 #include "esp_hsv_color.h"
 
@@ -52,7 +55,19 @@ class ESPRangeView : public ESPColorSettable {
   }
   ESPRangeView &operator=(const ESPRangeView &rhs);
 
+  /// Blend every LED toward `color`, the same as `color * alpha + led * (255 - alpha)` on each LED.
+  void blend_toward(const Color &color, uint8_t alpha);
+
+  /// Replace the color of every LED with `func(color)` through a lookup table on the raw buffer. `func` has to treat
+  /// every channel the same way and on its own. Returns false if the light doesn't expose its buffer, or the range is
+  /// too small for that to pay off; the caller then has to go over the LEDs itself.
+  bool map_colors(const std::function<Color(Color)> &func);
+
  protected:
+  /// The raw buffer of this range, converted to color space so the span kernels give the same result as the
+  /// per-LED path. Invalid if the light doesn't expose its buffer; otherwise finish with `span.correct()`.
+  ESPColorSpan uncorrected_span_();
+
   friend ESPRangeIterator;
 
   AddressableLight *parent_;
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace light {
+
+/** Encoder for one-wire LED protocols that send every data bit as one of two fixed symbols, most significant bit
+ * first. The symbols of every nibble value are precomputed, so encoding a byte takes two table lookups instead of
+ * eight bit tests. `T` is the symbol type of the output peripheral, like `rmt_item32_t` on the ESP32.
+ */
+template<typename T> class LEDBitEncoder {
+ public:
+  void set_symbols(const T &bit0, const T &bit1) {
+    for (int nibble = 0; nibble < 16; nibble++) {
+      for (int i = 0; i < 4; i++)
+        this->nibbles_[nibble][i] = nibble & (1 << (3 - i)) ? bit1 : bit0;
+    }
+  }
+
+  /// Expand `length` bytes into `length * 8` symbols at `dest`. Always inlined, so it stays in IRAM when called
+  /// from an interrupt handler there.
+  inline void encode(const uint8_t *src, size_t length, T *dest) const ALWAYS_INLINE {
+    for (size_t i = 0; i < length; i++) {
+      const T *high = this->nibbles_[src[i] >> 4];
+      const T *low = this->nibbles_[src[i] & 0x0F];
+      for (int j = 0; j < 4; j++) {
+        dest[j] = high[j];
+        dest[j + 4] = low[j];
+      }
+      dest += 8;
+    }
+  }
+
+ protected:
+  T nibbles_[16][4];
+};
+
+/** Pack LED data into the words a PIO state machine shifts out most significant bit first: the three bytes of an
+ * LED in the top of its word, or all four bytes with a white channel. The bytes themselves go out unchanged.
+ */
+inline void encode_pio_words(const uint8_t *src, size_t num_leds, bool is_rgbw, uint32_t *dest) {
+  if (is_rgbw) {
+    for (size_t i = 0; i < num_leds; i++, src += 4)
+      dest[i] = encode_uint32(src[0], src[1], src[2], src[3]);
+  } else {
+    for (size_t i = 0; i < num_leds; i++, src += 3)
+      dest[i] = encode_uint32(src[0], src[1], src[2], 0);
+  }
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,105 @@
+#include "light_fixed_color_values.h"
+
+#include <algorithm>
+
+namespace esphome {
+namespace light {
+
+static const float COLOR_TEMPERATURE_SCALE = 16.0f;
+
+LightFixedColorValues::LightFixedColorValues(const LightColorValues &values) : color_mode(values.get_color_mode()) {
+  const float floats[CHANNELS] = {values.get_state(),      values.get_brightness(), values.get_color_brightness(),
+                                  values.get_red(),        values.get_green(),      values.get_blue(),
+                                  values.get_white(),      0.0f,                    values.get_cold_white(),
+                                  values.get_warm_white()};
+  for (uint8_t i = 0; i < CHANNELS; i++)
+    this->channels[i] = lroundf(floats[i] * ONE);
+  this->channels[COLOR_TEMPERATURE] = lroundf(values.get_color_temperature() * COLOR_TEMPERATURE_SCALE);
+}
+
+LightColorValues LightFixedColorValues::to_color_values() const {
+  return LightColorValues(this->color_mode, to_float_(this->channels[STATE]), to_float_(this->channels[BRIGHTNESS]),
+                          to_float_(this->channels[COLOR_BRIGHTNESS]), to_float_(this->channels[RED]),
+                          to_float_(this->channels[GREEN]), to_float_(this->channels[BLUE]),
+                          to_float_(this->channels[WHITE]),
+                          this->channels[COLOR_TEMPERATURE] / COLOR_TEMPERATURE_SCALE,
+                          to_float_(this->channels[COLD_WHITE]), to_float_(this->channels[WARM_WHITE]));
+}
+
+void LightFixedColorValues::as_brightness(float *brightness, const LightGammaTable &gamma) const {
+  *brightness = to_float_(gamma.correct(multiply_(this->channels[STATE], this->channels[BRIGHTNESS])));
+}
+
+void LightFixedColorValues::as_rgb(float *red, float *green, float *blue, const LightGammaTable &gamma) const {
+  if (this->color_mode & ColorCapability::RGB) {
+    const int32_t brightness = multiply_(multiply_(this->channels[STATE], this->channels[BRIGHTNESS]),
+                                         this->channels[COLOR_BRIGHTNESS]);
+    *red = to_float_(gamma.correct(multiply_(brightness, this->channels[RED])));
+    *green = to_float_(gamma.correct(multiply_(brightness, this->channels[GREEN])));
+    *blue = to_float_(gamma.correct(multiply_(brightness, this->channels[BLUE])));
+  } else {
+    *red = *green = *blue = 0;
+  }
+}
+
+void LightFixedColorValues::as_rgbw(float *red, float *green, float *blue, float *white,
+                                    const LightGammaTable &gamma) const {
+  this->as_rgb(red, green, blue, gamma);
+  if (this->color_mode & ColorCapability::WHITE) {
+    const int32_t brightness = multiply_(this->channels[STATE], this->channels[BRIGHTNESS]);
+    *white = to_float_(gamma.correct(multiply_(brightness, this->channels[WHITE])));
+  } else {
+    *white = 0;
+  }
+}
+
+void LightFixedColorValues::as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white,
+                                     const LightGammaTable &gamma, bool constant_brightness) const {
+  this->as_rgb(red, green, blue, gamma);
+  this->as_cwww(cold_white, warm_white, gamma, constant_brightness);
+}
+
+void LightFixedColorValues::as_rgbct(float color_temperature_cw, float color_temperature_ww, float *red, float *green,
+                                     float *blue, float *color_temperature, float *white_brightness,
+                                     const LightGammaTable &gamma) const {
+  this->as_rgb(red, green, blue, gamma);
+  this->as_ct(color_temperature_cw, color_temperature_ww, color_temperature, white_brightness, gamma);
+}
+
+void LightFixedColorValues::as_cwww(float *cold_white, float *warm_white, const LightGammaTable &gamma,
+                                    bool constant_brightness) const {
+  if (this->color_mode & ColorCapability::COLD_WARM_WHITE) {
+    const int32_t cw_level = gamma.correct(this->channels[COLD_WHITE]);
+    const int32_t ww_level = gamma.correct(this->channels[WARM_WHITE]);
+    const int32_t white_level = gamma.correct(multiply_(this->channels[STATE], this->channels[BRIGHTNESS]));
+    if (!constant_brightness) {
+      *cold_white = to_float_(multiply_(white_level, cw_level));
+      *warm_white = to_float_(multiply_(white_level, ww_level));
+    } else {
+      // See LightColorValues::as_cwww() for why the highest channel sets the brightness
+      const int32_t sum = cw_level > 0 || ww_level > 0 ? cw_level + ww_level : ONE;  // Don't divide by zero.
+      const int32_t level = multiply_(white_level, std::max(cw_level, ww_level));
+      *cold_white = to_float_(level * cw_level / sum);
+      *warm_white = to_float_(level * ww_level / sum);
+    }
+  } else {
+    *cold_white = *warm_white = 0;
+  }
+}
+
+void LightFixedColorValues::as_ct(float color_temperature_cw, float color_temperature_ww, float *color_temperature,
+                                  float *white_brightness, const LightGammaTable &gamma) const {
+  const int32_t white_level = this->color_mode & ColorCapability::RGB ? this->channels[WHITE] : ONE;
+  if (this->color_mode & ColorCapability::COLOR_TEMPERATURE) {
+    // The range of the traits is in floats, so the color temperature leaves as a float fraction of it
+    *color_temperature = (this->channels[COLOR_TEMPERATURE] / COLOR_TEMPERATURE_SCALE - color_temperature_cw) /
+                         (color_temperature_ww - color_temperature_cw);
+    const int32_t brightness = multiply_(this->channels[STATE], this->channels[BRIGHTNESS]);
+    *white_brightness = to_float_(gamma.correct(multiply_(brightness, white_level)));
+  } else {  // Probably won't get here but put this here anyway.
+    *white_brightness = 0;
+  }
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "color_mode.h"
+#include "light_color_values.h"
+#include "light_gamma_table.h"
+
+namespace esphome {
+namespace light {
+
+/** The color state of a light in fixed point, for lights with fixed-point transitions.
+ *
+ * Holds the same channels as LightColorValues. All of them are Q15 values from 0 to ONE, except for the color
+ * temperature, which is in 1/16 mireds. That keeps interpolation within 32 bits for color temperatures below 4096
+ * mireds.
+ *
+ * The as_* methods match those of LightColorValues, but do all of their math on integers and correct gamma through a
+ * LightGammaTable. Only their results are converted to floats, as that is what light outputs take.
+ */
+class LightFixedColorValues {
+ public:
+  static const uint8_t FRACTION_BITS = LightGammaTable::FRACTION_BITS;
+  static const int32_t ONE = LightGammaTable::ONE;
+
+  enum Channel : uint8_t {
+    STATE,
+    BRIGHTNESS,
+    COLOR_BRIGHTNESS,
+    RED,
+    GREEN,
+    BLUE,
+    WHITE,
+    COLOR_TEMPERATURE,
+    COLD_WHITE,
+    WARM_WHITE,
+    CHANNELS,
+  };
+
+  LightFixedColorValues() = default;
+  explicit LightFixedColorValues(const LightColorValues &values);
+
+  /// Convert back to floating point, for when the values leave the fixed-point pipeline.
+  LightColorValues to_color_values() const;
+
+  /// Fixed-point version of LightColorValues::lerp(), with completion from 0 to ONE.
+  static LightFixedColorValues lerp(const LightFixedColorValues &start, const LightFixedColorValues &end,
+                                    int32_t completion) {
+    LightFixedColorValues v;
+    v.color_mode = end.color_mode;
+    for (uint8_t i = 0; i < CHANNELS; i++)
+      v.channels[i] = start.channels[i] + (((end.channels[i] - start.channels[i]) * completion) >> FRACTION_BITS);
+    return v;
+  }
+
+  void as_brightness(float *brightness, const LightGammaTable &gamma) const;
+  void as_rgb(float *red, float *green, float *blue, const LightGammaTable &gamma) const;
+  void as_rgbw(float *red, float *green, float *blue, float *white, const LightGammaTable &gamma) const;
+  void as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white,
+                const LightGammaTable &gamma, bool constant_brightness = false) const;
+  void as_rgbct(float color_temperature_cw, float color_temperature_ww, float *red, float *green, float *blue,
+                float *color_temperature, float *white_brightness, const LightGammaTable &gamma) const;
+  void as_cwww(float *cold_white, float *warm_white, const LightGammaTable &gamma,
+               bool constant_brightness = false) const;
+  void as_ct(float color_temperature_cw, float color_temperature_ww, float *color_temperature, float *white_brightness,
+             const LightGammaTable &gamma) const;
+
+  ColorMode color_mode{ColorMode::UNKNOWN};
+  int32_t channels[CHANNELS]{};
+
+ protected:
+  static int32_t multiply_(int32_t a, int32_t b) { return (a * b) >> FRACTION_BITS; }
+  static float to_float_(int32_t value) { return value * (1.0f / ONE); }
+};
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,13 @@
+#include "light_gamma_table.h"
+#include "esphome/core/helpers.h"
+
+namespace esphome {
+namespace light {
+
+void LightGammaTable::set_gamma(float gamma) {
+  for (uint8_t i = 0; i <= SEGMENTS; i++)
+    this->table_[i] = static_cast<uint16_t>(lroundf(gamma_correct(i / float(SEGMENTS), gamma) * ONE));
+}
+
+}  // namespace light
+}  // namespace esphome
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+
+namespace esphome {
+namespace light {
+
+/** Gamma correction through a precomputed table, in fixed point.
+ *
+ * The curve is sampled at 64 evenly spaced points and linearly interpolated in between. For the usual gamma values
+ * this stays within 0.02% of full scale from gamma_correct() while costing only a few integer operations, which
+ * matters on chips without an FPU, where every powf() call takes thousands of cycles.
+ */
+class LightGammaTable {
+ public:
+  /// Fixed-point format of the values in and out of the table: Q15, so 0 to 1 maps to 0 to ONE.
+  static const uint8_t FRACTION_BITS = 15;
+  static const int32_t ONE = 1 << FRACTION_BITS;
+
+  explicit LightGammaTable(float gamma) { this->set_gamma(gamma); }
+
+  void set_gamma(float gamma);
+  /// Same as gamma_correct(value, gamma), on Q15 values.
+  int32_t correct(int32_t value) const {
+    if (value <= 0)
+      return 0;
+    if (value >= ONE)
+      return ONE;
+
+    const int32_t low = this->table_[value >> SEGMENT_BITS];
+    const int32_t high = this->table_[(value >> SEGMENT_BITS) + 1];
+    return low + (((high - low) * (value & SEGMENT_MASK)) >> SEGMENT_BITS);
+  }
+
+ protected:
+  static const uint8_t SEGMENTS = 64;
+  /// Every segment spans 2^9 input steps.
+  static const uint8_t SEGMENT_BITS = FRACTION_BITS - 6;
+  static const int32_t SEGMENT_MASK = (1 << SEGMENT_BITS) - 1;
+
+  uint16_t table_[SEGMENTS + 1];
+};
+
+}  // namespace light
+}  // namespace esphome
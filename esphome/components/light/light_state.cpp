@@ -104,6 +104,7 @@ void LightState::dump_config() {
   if (this->get_traits().supports_color_capability(ColorCapability::BRIGHTNESS)) {
     ESP_LOGCONFIG(TAG, "  Default Transition Length: %.1fs", this->default_transition_length_ / 1e3f);
     ESP_LOGCONFIG(TAG, "  Gamma Correct: %.2f", this->gamma_correct_);
+    ESP_LOGCONFIG(TAG, "  Fixed-Point Transitions: %s", YESNO(this->gamma_table_ != nullptr));
   }
   if (this->get_traits().supports_color_capability(ColorCapability::COLOR_TEMPERATURE)) {
     ESP_LOGCONFIG(TAG, "  Min Mireds: %.1f", this->get_traits().get_min_mireds());
@@ -129,6 +130,7 @@ void LightState::loop() {
     if (this->transformer_->is_finished()) {
       // if the transition has written directly to the output, current_values is outdated, so update it
       this->current_values = this->transformer_->get_target_values();
+      this->has_fixed_values_ = false;
 
       this->transformer_->stop();
       this->transformer_ = nullptr;
@@ -171,7 +173,38 @@ void LightState::set_flash_transition_length(uint32_t flash_transition_length) {
   this->flash_transition_length_ = flash_transition_length;
 }
 uint32_t LightState::get_flash_transition_length() const { return this->flash_transition_length_; }
-void LightState::set_gamma_correct(float gamma_correct) { this->gamma_correct_ = gamma_correct; }
+void LightState::set_gamma_correct(float gamma_correct) {
+  this->gamma_correct_ = gamma_correct;
+  if (this->gamma_table_ != nullptr)
+    this->gamma_table_->set_gamma(gamma_correct);
+}
+void LightState::set_fixed_point_transitions(bool fixed_point_transitions) {
+  if (!fixed_point_transitions) {
+    this->gamma_table_ = nullptr;
+  } else if (this->gamma_table_ == nullptr) {
+    this->gamma_table_ = make_unique<LightGammaTable>(this->gamma_correct_);
+  }
+}
+std::unique_ptr<LightTransformer> LightState::create_default_transition() {
+  if (this->gamma_table_ != nullptr)
+    return make_unique<LightFixedPointTransitionTransformer>(*this);
+  return this->output_->create_default_transition();
+}
+void LightState::write_fixed_values(const LightFixedColorValues &values) {
+  this->fixed_values_ = values;
+  this->has_fixed_values_ = true;
+  this->output_->update_state(this);
+  this->next_write_ = true;
+}
+void LightState::flush_fixed_values() {
+  if (!this->has_fixed_values_)
+    return;
+  this->current_values = this->fixed_values_.to_color_values();
+  this->has_fixed_values_ = false;
+}
+LightFixedColorValues LightState::get_fixed_values_() const {
+  return this->has_fixed_values_ ? this->fixed_values_ : LightFixedColorValues(this->current_values);
+}
 void LightState::set_restore_mode(LightRestoreMode restore_mode) { this->restore_mode_ = restore_mode; }
 bool LightState::supports_effects() { return !this->effects_.empty(); }
 const std::vector<LightEffect *> &LightState::get_effects() const { return this->effects_; }
@@ -184,34 +217,65 @@ void LightState::add_effects(const std::vector<LightEffect *> &effects) {
 
 void LightState::current_values_as_binary(bool *binary) { this->current_values.as_binary(binary); }
 void LightState::current_values_as_brightness(float *brightness) {
-  this->current_values.as_brightness(brightness, this->gamma_correct_);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_brightness(brightness, *this->gamma_table_);
+  } else {
+    this->current_values.as_brightness(brightness, this->gamma_correct_);
+  }
 }
 void LightState::current_values_as_rgb(float *red, float *green, float *blue, bool color_interlock) {
   auto traits = this->get_traits();
-  this->current_values.as_rgb(red, green, blue, this->gamma_correct_, false);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_rgb(red, green, blue, *this->gamma_table_);
+  } else {
+    this->current_values.as_rgb(red, green, blue, this->gamma_correct_, false);
+  }
 }
 void LightState::current_values_as_rgbw(float *red, float *green, float *blue, float *white, bool color_interlock) {
   auto traits = this->get_traits();
-  this->current_values.as_rgbw(red, green, blue, white, this->gamma_correct_, false);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_rgbw(red, green, blue, white, *this->gamma_table_);
+  } else {
+    this->current_values.as_rgbw(red, green, blue, white, this->gamma_correct_, false);
+  }
 }
 void LightState::current_values_as_rgbww(float *red, float *green, float *blue, float *cold_white, float *warm_white,
                                          bool constant_brightness) {
-  this->current_values.as_rgbww(red, green, blue, cold_white, warm_white, this->gamma_correct_, constant_brightness);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_rgbww(red, green, blue, cold_white, warm_white, *this->gamma_table_,
+                                       constant_brightness);
+  } else {
+    this->current_values.as_rgbww(red, green, blue, cold_white, warm_white, this->gamma_correct_, constant_brightness);
+  }
 }
 void LightState::current_values_as_rgbct(float *red, float *green, float *blue, float *color_temperature,
                                          float *white_brightness) {
   auto traits = this->get_traits();
-  this->current_values.as_rgbct(traits.get_min_mireds(), traits.get_max_mireds(), red, green, blue, color_temperature,
-                                white_brightness, this->gamma_correct_);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_rgbct(traits.get_min_mireds(), traits.get_max_mireds(), red, green, blue,
+                                       color_temperature, white_brightness, *this->gamma_table_);
+  } else {
+    this->current_values.as_rgbct(traits.get_min_mireds(), traits.get_max_mireds(), red, green, blue,
+                                  color_temperature, white_brightness, this->gamma_correct_);
+  }
 }
 void LightState::current_values_as_cwww(float *cold_white, float *warm_white, bool constant_brightness) {
   auto traits = this->get_traits();
-  this->current_values.as_cwww(cold_white, warm_white, this->gamma_correct_, constant_brightness);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_cwww(cold_white, warm_white, *this->gamma_table_, constant_brightness);
+  } else {
+    this->current_values.as_cwww(cold_white, warm_white, this->gamma_correct_, constant_brightness);
+  }
 }
 void LightState::current_values_as_ct(float *color_temperature, float *white_brightness) {
   auto traits = this->get_traits();
-  this->current_values.as_ct(traits.get_min_mireds(), traits.get_max_mireds(), color_temperature, white_brightness,
-                             this->gamma_correct_);
+  if (this->gamma_table_ != nullptr) {
+    this->get_fixed_values_().as_ct(traits.get_min_mireds(), traits.get_max_mireds(), color_temperature,
+                                    white_brightness, *this->gamma_table_);
+  } else {
+    this->current_values.as_ct(traits.get_min_mireds(), traits.get_max_mireds(), color_temperature, white_brightness,
+                               this->gamma_correct_);
+  }
 }
 
 void LightState::start_effect_(uint32_t effect_index) {
@@ -239,7 +303,8 @@ void LightState::stop_effect_() {
 }
 
 void LightState::start_transition_(const LightColorValues &target, uint32_t length, bool set_remote_values) {
-  this->transformer_ = this->output_->create_default_transition();
+  this->flush_fixed_values();
+  this->transformer_ = this->create_default_transition();
   this->transformer_->setup(this->current_values, target, length);
 
   if (set_remote_values) {
@@ -248,6 +313,7 @@ void LightState::start_transition_(const LightColorValues &target, uint32_t leng
 }
 
 void LightState::start_flash_(const LightColorValues &target, uint32_t length, bool set_remote_values) {
+  this->flush_fixed_values();
   LightColorValues end_colors = this->remote_values;
   // If starting a flash if one is already happening, set end values to end values of current flash
   // Hacky but works
@@ -263,6 +329,7 @@ void LightState::start_flash_(const LightColorValues &target, uint32_t length, b
 }
 
 void LightState::set_immediately_(const LightColorValues &target, bool set_remote_values) {
+  this->flush_fixed_values();
   this->transformer_ = nullptr;
   this->current_values = target;
   if (set_remote_values) {
@@ -7,6 +7,8 @@
 #include "light_call.h"
 #include "light_color_values.h"
 #include "light_effect.h"
+#include "light_fixed_color_values.h"
+#include "light_gamma_table.h"
 #include "light_traits.h"
 #include "light_transformer.h"
 
@@ -113,6 +115,21 @@ class LightState : public EntityBase, public Component {
   void set_gamma_correct(float gamma_correct);
   float get_gamma_correct() const { return this->gamma_correct_; }
 
+  /// Use fixed-point transitions and a gamma correction table instead of floating-point math and powf().
+  void set_fixed_point_transitions(bool fixed_point_transitions);
+
+  /// Create the transition used to move between two states, chosen by output and light configuration.
+  std::unique_ptr<LightTransformer> create_default_transition();
+
+  /** Write the values of a fixed-point transition to the output.
+   *
+   * The values stay in fixed point all the way to the output, so current_values is only brought up to date by
+   * flush_fixed_values() when the transition stops.
+   */
+  void write_fixed_values(const LightFixedColorValues &values);
+  /// Update current_values from the last values of a fixed-point transition, if there are any.
+  void flush_fixed_values();
+
   /// Set the restore mode of this light
   void set_restore_mode(LightRestoreMode restore_mode);
 
@@ -167,6 +184,9 @@ class LightState : public EntityBase, public Component {
   /// Internal method to save the current remote_values to the preferences
   void save_remote_values_();
 
+  /// Values of the running fixed-point transition, or current_values converted to fixed point.
+  LightFixedColorValues get_fixed_values_() const;
+
   /// Store the output to allow effects to have more access.
   LightOutput *output_;
   /// Value for storing the index of the currently active effect. 0 if no effect is active
@@ -199,6 +219,11 @@ class LightState : public EntityBase, public Component {
   uint32_t flash_transition_length_{};
   /// Gamma correction factor for the light.
   float gamma_correct_{};
+  /// Gamma correction table, only present when fixed-point transitions are enabled.
+  std::unique_ptr<LightGammaTable> gamma_table_{nullptr};
+  /// Values written by a fixed-point transition, newer than current_values while has_fixed_values_ is set.
+  LightFixedColorValues fixed_values_;
+  bool has_fixed_values_{false};
   /// Restore mode of the light.
   LightRestoreMode restore_mode_;
   /// List of effects for this light.
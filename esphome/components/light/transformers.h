@@ -3,6 +3,7 @@
 #include "esphome/core/component.h"
 #include "esphome/core/helpers.h"
 #include "light_color_values.h"
+#include "light_fixed_color_values.h"
 #include "light_state.h"
 #include "light_transformer.h"
 
@@ -64,6 +65,80 @@ class LightTransitionTransformer : public LightTransformer {
   LightColorValues intermediate_values_{};
 };
 
+/** Transition that runs in fixed point instead of floating point.
+ *
+ * Start and end values are converted to LightFixedColorValues once per phase of the transition. Every frame then
+ * interpolates them with integer math and hands the result to the light state, which converts it for the output
+ * through its gamma table without going back to LightColorValues. Meant for chips without an FPU, where many lights
+ * transitioning at once otherwise stall the loop.
+ */
+class LightFixedPointTransitionTransformer : public LightTransitionTransformer {
+ public:
+  LightFixedPointTransitionTransformer(LightState &state) : state_(state) {}
+
+  void start() override {
+    LightTransitionTransformer::start();
+    this->phase_ = NO_PHASE;
+  }
+
+  optional<LightColorValues> apply() override {
+    int32_t p = this->get_fixed_progress_();
+
+    // Same phases as in LightTransitionTransformer::apply()
+    if (this->changing_color_mode_ && p > ONE / 2 &&
+        this->intermediate_values_.get_color_mode() != this->target_values_.get_color_mode()) {
+      this->intermediate_values_ = this->target_values_;
+      this->intermediate_values_.set_state(false);
+    }
+
+    const uint8_t phase = this->changing_color_mode_ && p > ONE / 2;
+    if (phase != this->phase_) {
+      const LightColorValues &start = phase == 1 ? this->intermediate_values_ : this->start_values_;
+      const LightColorValues &end = this->changing_color_mode_ && phase == 0 ? this->intermediate_values_
+                                                                             : this->end_values_;
+      this->start_ = LightFixedColorValues(start);
+      this->end_ = LightFixedColorValues(end);
+      this->phase_ = phase;
+    }
+    if (this->changing_color_mode_)
+      p = p < ONE / 2 ? p * 2 : (p - ONE / 2) * 2;
+
+    this->state_.write_fixed_values(LightFixedColorValues::lerp(this->start_, this->end_, smoothed_fixed_progress(p)));
+    // The values went straight to the light state, which updates current_values when the transition stops
+    return {};
+  }
+
+  bool is_finished() override { return this->get_fixed_progress_() >= ONE; }
+
+  void stop() override { this->state_.flush_fixed_values(); }
+
+ protected:
+  static const uint8_t FRACTION_BITS = LightFixedColorValues::FRACTION_BITS;
+  static const int32_t ONE = LightFixedColorValues::ONE;
+  static const uint8_t NO_PHASE = 0xFF;
+
+  /// Progress of the transition, from 0 to ONE.
+  int32_t get_fixed_progress_() {
+    const uint32_t elapsed = millis() - this->start_time_;
+    if (elapsed >= this->length_)
+      return ONE;
+    return (uint64_t(elapsed) << FRACTION_BITS) / this->length_;
+  }
+
+  /// Fixed-point version of LightTransitionTransformer::smoothed_progress(): 6x^5 - 15x^4 + 10x^3.
+  static int32_t smoothed_fixed_progress(int32_t x) {
+    int64_t v = x * int64_t(6 * x - 15 * ONE) / ONE + 10 * ONE;
+    v = v * x / ONE;
+    v = v * x / ONE;
+    return v * x / ONE;
+  }
+
+  LightState &state_;
+  uint8_t phase_{NO_PHASE};
+  LightFixedColorValues start_;
+  LightFixedColorValues end_;
+};
+
 class LightFlashTransformer : public LightTransformer {
  public:
   LightFlashTransformer(LightState &state) : state_(state) {}
@@ -76,7 +151,7 @@ class LightFlashTransformer : public LightTransformer {
     this->begun_lightstate_restore_ = false;
 
     // first transition to original target
-    this->transformer_ = this->state_.get_output()->create_default_transition();
+    this->transformer_ = this->state_.create_default_transition();
     this->transformer_->setup(this->state_.current_values, this->target_values_, this->transition_length_);
   }
 
@@ -85,7 +160,7 @@ class LightFlashTransformer : public LightTransformer {
 
     if (this->transformer_ == nullptr && millis() > this->start_time_ + this->length_ - this->transition_length_) {
       // second transition back to start value
-      this->transformer_ = this->state_.get_output()->create_default_transition();
+      this->transformer_ = this->state_.create_default_transition();
       this->transformer_->setup(this->state_.current_values, this->get_start_values(), this->transition_length_);
       this->begun_lightstate_restore_ = true;
     }
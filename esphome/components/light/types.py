@@ -8,6 +8,7 @@ AddressableLightState = light_ns.class_("AddressableLightState", LightState)
 LightOutput = light_ns.class_("LightOutput")
 AddressableLight = light_ns.class_("AddressableLight", LightOutput, cg.Component)
 AddressableLightRef = AddressableLight.operator("ref")
+AddressableLightFrameGroup = light_ns.class_("AddressableLightFrameGroup")
 
 Color = cg.esphome_ns.class_("Color")
 LightColorValues = light_ns.class_("LightColorValues")
@@ -76,3 +77,13 @@ AddressableFireworksEffect = light_ns.class_(
 AddressableFlickerEffect = light_ns.class_(
     "AddressableFlickerEffect", AddressableLightEffect
 )
+AddressableCompositeEffect = light_ns.class_(
+    "AddressableCompositeEffect", AddressableLightEffect
+)
+BlendMode = light_ns.enum("BlendMode")
+BLEND_MODES = {
+    "ADD": BlendMode.BLEND_MODE_ADD,
+    "ALPHA": BlendMode.BLEND_MODE_ALPHA,
+    "MAX": BlendMode.BLEND_MODE_MAX,
+    "MASK": BlendMode.BLEND_MODE_MASK,
+}
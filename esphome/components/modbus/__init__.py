@@ -7,32 +7,66 @@ from esphome.const import (
     CONF_ID,
     CONF_ADDRESS,
     CONF_DISABLE_CRC,
+    CONF_PORT,
 )
+from esphome.core import CORE
 from esphome import pins
 
-DEPENDENCIES = ["uart"]
+
+def AUTO_LOAD():
+    # Only the TCP transport needs sockets
+    confs = (getattr(CORE, "raw_config", None) or {}).get("modbus") or []
+    if isinstance(confs, dict):
+        confs = [confs]
+    for conf in confs:
+        if str(conf.get(CONF_TRANSPORT, "")).lower() == TRANSPORT_TCP:
+            return ["socket"]
+    return []
+
 
 modbus_ns = cg.esphome_ns.namespace("modbus")
-Modbus = modbus_ns.class_("Modbus", cg.Component, uart.UARTDevice)
+Modbus = modbus_ns.class_("Modbus", cg.Component)
+ModbusRtu = modbus_ns.class_("ModbusRtu", Modbus, uart.UARTDevice)
+ModbusTcp = modbus_ns.class_("ModbusTcp", Modbus)
 ModbusDevice = modbus_ns.class_("ModbusDevice")
 MULTI_CONF = True
 
 CONF_MODBUS_ID = "modbus_id"
 CONF_SEND_WAIT_TIME = "send_wait_time"
+CONF_TRANSPORT = "transport"
+CONF_HOST = "host"
+
+TRANSPORT_RTU = "rtu"
+TRANSPORT_TCP = "tcp"
 
-CONFIG_SCHEMA = (
-    cv.Schema(
-        {
-            cv.GenerateID(): cv.declare_id(Modbus),
-            cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
-            cv.Optional(
-                CONF_SEND_WAIT_TIME, default="250ms"
-            ): cv.positive_time_period_milliseconds,
-            cv.Optional(CONF_DISABLE_CRC, default=False): cv.boolean,
-        }
-    )
-    .extend(cv.COMPONENT_SCHEMA)
-    .extend(uart.UART_DEVICE_SCHEMA)
+CONFIG_SCHEMA = cv.typed_schema(
+    {
+        TRANSPORT_RTU: cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(ModbusRtu),
+                cv.Optional(CONF_FLOW_CONTROL_PIN): pins.gpio_output_pin_schema,
+                cv.Optional(
+                    CONF_SEND_WAIT_TIME, default="250ms"
+                ): cv.positive_time_period_milliseconds,
+                cv.Optional(CONF_DISABLE_CRC, default=False): cv.boolean,
+            }
+        )
+        .extend(cv.COMPONENT_SCHEMA)
+        .extend(uart.UART_DEVICE_SCHEMA),
+        TRANSPORT_TCP: cv.Schema(
+            {
+                cv.GenerateID(): cv.declare_id(ModbusTcp),
+                cv.Required(CONF_HOST): cv.ipv4,
+                cv.Optional(CONF_PORT, default=502): cv.port,
+                cv.Optional(
+                    CONF_SEND_WAIT_TIME, default="250ms"
+                ): cv.positive_time_period_milliseconds,
+            }
+        ).extend(cv.COMPONENT_SCHEMA),
+    },
+    key=CONF_TRANSPORT,
+    default_type=TRANSPORT_RTU,
+    lower=True,
 )
 
 
@@ -41,14 +75,21 @@ async def to_code(config):
     var = cg.new_Pvariable(config[CONF_ID])
     await cg.register_component(var, config)
 
-    await uart.register_uart_device(var, config)
+    if config[CONF_TRANSPORT] == TRANSPORT_RTU:
+        cg.add_define("USE_MODBUS_RTU")
+        await uart.register_uart_device(var, config)
 
-    if CONF_FLOW_CONTROL_PIN in config:
-        pin = await gpio_pin_expression(config[CONF_FLOW_CONTROL_PIN])
-        cg.add(var.set_flow_control_pin(pin))
+        if CONF_FLOW_CONTROL_PIN in config:
+            pin = await gpio_pin_expression(config[CONF_FLOW_CONTROL_PIN])
+            cg.add(var.set_flow_control_pin(pin))
+
+        cg.add(var.set_disable_crc(config[CONF_DISABLE_CRC]))
+    else:
+        cg.add_define("USE_MODBUS_TCP")
+        cg.add(var.set_host(str(config[CONF_HOST])))
+        cg.add(var.set_port(config[CONF_PORT]))
 
     cg.add(var.set_send_wait_time(config[CONF_SEND_WAIT_TIME]))
-    cg.add(var.set_disable_crc(config[CONF_DISABLE_CRC]))
 
 
 def modbus_device_schema(default_address):
@@ -1,153 +1,153 @@
 #include "modbus.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
+#include <algorithm>
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus {
 
 static const char *const TAG = "modbus";
 
+static const uint32_t STATS_INTERVAL = 60000;
+
 void Modbus::setup() {
-  if (this->flow_control_pin_ != nullptr) {
-    this->flow_control_pin_->setup();
-  }
+  this->stats_start_us_ = micros();
+  this->set_interval("stats", STATS_INTERVAL, [this]() { this->log_stats_(); });
 }
+
 void Modbus::loop() {
-  const uint32_t now = millis();
+  const uint32_t now = micros();
 
-  if (now - this->last_modbus_byte_ > 50) {
-    this->rx_buffer_.clear();
-    this->last_modbus_byte_ = now;
-  }
-  // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
-  if (now - this->last_send_ > send_wait_time_) {
-    waiting_for_response = 0;
-  }
+  this->receive_(now);
 
-  while (this->available()) {
-    uint8_t byte;
-    this->read_byte(&byte);
-    if (this->parse_modbus_byte_(byte)) {
-      this->last_modbus_byte_ = now;
+  // stop blocking new send commands after send_wait_time_ ms regardless if a response has been received since then
+  for (size_t i = 0; i < this->transactions_.size();) {
+    if (now - this->transactions_[i].start_us > this->send_wait_time_ * 1000u) {
+      ESP_LOGV(TAG, "No response from device 0x%02X", this->transactions_[i].address);
+      this->end_transaction_(i, now, false);
     } else {
-      this->rx_buffer_.clear();
+      i++;
     }
   }
-}
 
-bool Modbus::parse_modbus_byte_(uint8_t byte) {
-  size_t at = this->rx_buffer_.size();
-  this->rx_buffer_.push_back(byte);
-  const uint8_t *raw = &this->rx_buffer_[0];
-  ESP_LOGV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
-  // Byte 0: modbus address (match all)
-  if (at == 0)
-    return true;
-  uint8_t address = raw[0];
-  uint8_t function_code = raw[1];
-  // Byte 2: Size (with modbus rtu function code 4/3)
-  // See also https://en.wikipedia.org/wiki/Modbus
-  if (at == 2)
-    return true;
-
-  uint8_t data_len = raw[2];
-  uint8_t data_offset = 3;
-
-  // Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
-  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
-    // Handle user-defined function, since we don't know how big this ought to be,
-    // ideally we should delegate the entire length detection to whatever handler is
-    // installed, but wait, there is the CRC, and if we get a hit there is a good
-    // chance that this is a complete message ... admittedly there is a small chance is
-    // isn't but that is quite small given the purpose of the CRC in the first place
-
-    // Fewer than 2 bytes can't calc CRC
-    if (at < 2)
-      return true;
-
-    data_len = at - 2;
-    data_offset = 1;
-
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-
-    if (computed_crc != remote_crc)
-      return true;
-
-    ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
-
-  } else {
-    // the response for write command mirrors the requests and data startes at offset 2 instead of 3 for read commands
-    if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
-      data_offset = 2;
-      data_len = 4;
-    }
+  this->schedule_next_(now);
+}
 
-    // Error ( msb indicates error )
-    // response format:  Byte[0] = device address, Byte[1] function code | 0x80 , Byte[2] exception code, Byte[3-4] crc
-    if ((function_code & 0x80) == 0x80) {
-      data_offset = 2;
-      data_len = 1;
-    }
+bool Modbus::is_waiting_for(uint8_t address) const {
+  if (!this->pipelined_)
+    return !this->transactions_.empty();
+  return std::any_of(this->transactions_.begin(), this->transactions_.end(),
+                     [address](const Transaction &transaction) { return transaction.address == address; });
+}
 
-    // Byte data_offset..data_offset+data_len-1: Data
-    if (at < data_offset + data_len)
-      return true;
+void Modbus::begin_transaction_(uint8_t address, uint16_t id) {
+  this->transactions_.push_back({address, id, micros()});
+  this->waiting_for_response = address;
+  // Pick up the response and send the next request as soon as possible instead of once per loop interval
+  this->high_freq_.start();
+}
 
-    // Byte 3+data_len: CRC_LO (over all bytes)
-    if (at == data_offset + data_len)
-      return true;
+void Modbus::end_transaction_(size_t index, uint32_t now, bool responded) {
+  const Transaction transaction = this->transactions_[index];
+  this->transactions_.erase(this->transactions_.begin() + index);
+  this->waiting_for_response = this->transactions_.empty() ? 0 : this->transactions_.back().address;
 
-    // Byte data_offset+len+1: CRC_HI (over all bytes)
-    uint16_t computed_crc = crc16(raw, data_offset + data_len);
-    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
-    if (computed_crc != remote_crc) {
-      if (this->disable_crc_) {
-        ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", computed_crc, remote_crc);
-      } else {
-        ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
-        return false;
-      }
+  const uint32_t duration = now - transaction.start_us;
+  this->busy_us_ += duration;
+  for (auto *device : this->devices_) {
+    if (device->address_ != transaction.address)
+      continue;
+    if (responded) {
+      const float latency = duration / 1000.0f;
+      device->average_latency_ =
+          device->average_latency_ == 0.0f ? latency : device->average_latency_ * 0.875f + latency * 0.125f;
+      device->responses_++;
+    } else {
+      device->timeouts_++;
     }
   }
-  std::vector<uint8_t> data(this->rx_buffer_.begin() + data_offset, this->rx_buffer_.begin() + data_offset + data_len);
+}
+
+void Modbus::handle_response_(uint8_t address, uint8_t function_code, const uint8_t *data, size_t len,
+                              int transaction) {
+  // The callbacks may send requests, or drop all pending transactions when that fails, so remember which one this
+  // response belongs to instead of holding on to its index
+  Transaction answered{};
+  if (transaction >= 0)
+    answered = this->transactions_[transaction];
   bool found = false;
   for (auto *device : this->devices_) {
     if (device->address_ == address) {
       // Is it an error response?
       if ((function_code & 0x80) == 0x80) {
-        ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, raw[2]);
-        if (waiting_for_response != 0) {
-          device->on_modbus_error(function_code & 0x7F, raw[2]);
+        ESP_LOGD(TAG, "Modbus error function code: 0x%X exception: %d", function_code, data[0]);
+        if (transaction >= 0) {
+          device->on_modbus_error(function_code & 0x7F, data[0]);
         } else {
           // Ignore modbus exception not related to a pending command
           ESP_LOGD(TAG, "Ignoring Modbus error - not expecting a response");
         }
       } else {
-        device->on_modbus_data(data);
+        device->on_modbus_data(std::vector<uint8_t>(data, data + len));
       }
       found = true;
     }
   }
-  waiting_for_response = 0;
+  if (transaction >= 0) {
+    for (size_t i = 0; i < this->transactions_.size(); i++) {
+      const Transaction &pending = this->transactions_[i];
+      if (pending.id == answered.id && pending.start_us == answered.start_us && pending.address == answered.address) {
+        this->end_transaction_(i, micros(), answered.address == address);
+        break;
+      }
+    }
+  }
 
   if (!found) {
     ESP_LOGW(TAG, "Got Modbus frame from unknown address 0x%02X! ", address);
   }
-
-  // return false to reset buffer
-  return false;
 }
 
-void Modbus::dump_config() {
-  ESP_LOGCONFIG(TAG, "Modbus:");
-  LOG_PIN("  Flow Control Pin: ", this->flow_control_pin_);
-  ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
-  ESP_LOGCONFIG(TAG, "  CRC Disabled: %s", YESNO(this->disable_crc_));
+void Modbus::schedule_next_(uint32_t now) {
+  if (!this->pipelined_ && !this->transactions_.empty())
+    return;
+  if (!this->can_send_(now))
+    return;
+
+  bool sent = false;
+  for (size_t i = 0; i < this->devices_.size(); i++) {
+    auto *device = this->devices_[this->next_device_];
+    this->next_device_ = (this->next_device_ + 1) % this->devices_.size();
+    if (this->is_waiting_for(device->address_) || !device->on_modbus_idle())
+      continue;
+    sent = true;
+    if (!this->pipelined_)
+      return;
+  }
+  // Nobody has anything to send; requests queued later are picked up at the normal loop interval
+  if (!sent && this->transactions_.empty())
+    this->high_freq_.stop();
 }
-float Modbus::get_setup_priority() const {
-  // After UART bus
-  return setup_priority::BUS - 1.0f;
+
+void Modbus::log_stats_() {
+  const uint32_t now = micros();
+  this->bus_utilization_ = std::min(float(this->busy_us_) / float(now - this->stats_start_us_), 1.0f);
+  this->busy_us_ = 0;
+  this->stats_start_us_ = now;
+
+  for (auto *device : this->devices_) {
+    if (device->responses_ == 0 && device->timeouts_ == 0)
+      continue;
+    ESP_LOGD(TAG, "Device 0x%02X: %" PRIu32 " responses, %" PRIu32 " timeouts, average latency %.1f ms",
+             device->address_, device->responses_, device->timeouts_, device->average_latency_);
+    device->responses_ = 0;
+    device->timeouts_ = 0;
+  }
+  if (this->bus_utilization_ > 0.0f)
+    ESP_LOGD(TAG, "Bus utilization: %.1f%%", this->bus_utilization_ * 100.0f);
 }
 
 void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
@@ -182,20 +182,7 @@ void Modbus::send(uint8_t address, uint8_t function_code, uint16_t start_address
     }
   }
 
-  auto crc = crc16(data.data(), data.size());
-  data.push_back(crc >> 0);
-  data.push_back(crc >> 8);
-
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(true);
-
-  this->write_array(data);
-  this->flush();
-
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(false);
-  waiting_for_response = address;
-  last_send_ = millis();
+  this->send_frame_(data);
   ESP_LOGV(TAG, "Modbus write: %s", format_hex_pretty(data).c_str());
 }
 
@@ -206,19 +193,8 @@ void Modbus::send_raw(const std::vector<uint8_t> &payload) {
     return;
   }
 
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(true);
-
-  auto crc = crc16(payload.data(), payload.size());
-  this->write_array(payload);
-  this->write_byte(crc & 0xFF);
-  this->write_byte((crc >> 8) & 0xFF);
-  this->flush();
-  if (this->flow_control_pin_ != nullptr)
-    this->flow_control_pin_->digital_write(false);
-  waiting_for_response = payload[0];
+  this->send_frame_(payload);
   ESP_LOGV(TAG, "Modbus write raw: %s", format_hex_pretty(payload).c_str());
-  last_send_ = millis();
 }
 
 }  // namespace modbus
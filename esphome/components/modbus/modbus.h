@@ -1,7 +1,7 @@
 #pragma once
 
 #include "esphome/core/component.h"
-#include "esphome/components/uart/uart.h"
+#include "esphome/core/helpers.h"
 
 #include <vector>
 
@@ -10,7 +10,12 @@ namespace modbus {
 
 class ModbusDevice;
 
-class Modbus : public uart::UARTDevice, public Component {
+/** Base class of the Modbus transports.
+ *
+ * Keeps track of the requests waiting for a response, hands responses to the devices and decides which device may
+ * send next. The transports frame the requests and responses for their medium.
+ */
+class Modbus : public Component {
  public:
   Modbus() = default;
 
@@ -18,30 +23,66 @@ class Modbus : public uart::UARTDevice, public Component {
 
   void loop() override;
 
-  void dump_config() override;
-
   void register_device(ModbusDevice *device) { this->devices_.push_back(device); }
 
-  float get_setup_priority() const override;
-
   void send(uint8_t address, uint8_t function_code, uint16_t start_address, uint16_t number_of_entities,
             uint8_t payload_len = 0, const uint8_t *payload = nullptr);
   void send_raw(const std::vector<uint8_t> &payload);
-  void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
   uint8_t waiting_for_response{0};
   void set_send_wait_time(uint16_t time_in_ms) { send_wait_time_ = time_in_ms; }
-  void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+
+  /// Whether a request to the device at `address` has to wait for the response to an earlier request.
+  bool is_waiting_for(uint8_t address) const;
+
+  /// Share of time the bus was busy with transactions during the last statistics interval, from 0 to 1.
+  float get_bus_utilization() const { return this->bus_utilization_; }
+  /// Time to transfer one character on the bus, in µs.
+  uint32_t get_char_time_us() const { return this->char_time_us_; }
+  /// Silent interval that separates frames (t3.5), in µs.
+  uint32_t get_frame_delay_us() const { return this->frame_delay_us_; }
 
  protected:
-  GPIOPin *flow_control_pin_{nullptr};
+  struct Transaction {
+    uint8_t address;
+    /// Transaction identifier of the request, for transports that have one.
+    uint16_t id;
+    uint32_t start_us;
+  };
+
+  /// Send a request: the device address followed by the PDU, without a checksum.
+  virtual void send_frame_(const std::vector<uint8_t> &frame) = 0;
+  /// Receive and handle the responses that have arrived.
+  virtual void receive_(uint32_t now) = 0;
+  /// Whether the transport is ready for another request.
+  virtual bool can_send_(uint32_t now) { return true; }
+
+  /// Mark the device at `address` busy until it responds or the send wait time passes.
+  void begin_transaction_(uint8_t address, uint16_t id = 0);
+  void end_transaction_(size_t index, uint32_t now, bool responded);
+  /** Hand a response to the devices at `address`.
+   *
+   * @param data the data of the response; the exception code for error responses.
+   * @param transaction index of the transaction the response answers, or -1 if it doesn't answer one.
+   */
+  void handle_response_(uint8_t address, uint8_t function_code, const uint8_t *data, size_t len, int transaction);
+  /// Let the devices send their next request, taking turns.
+  void schedule_next_(uint32_t now);
+  void log_stats_();
 
-  bool parse_modbus_byte_(uint8_t byte);
   uint16_t send_wait_time_{250};
-  bool disable_crc_;
-  std::vector<uint8_t> rx_buffer_;
-  uint32_t last_modbus_byte_{0};
-  uint32_t last_send_{0};
   std::vector<ModbusDevice *> devices_;
+  size_t next_device_{0};
+  std::vector<Transaction> transactions_;
+  /// Whether requests to different devices may wait for their responses at the same time.
+  bool pipelined_{false};
+  HighFrequencyLoopRequester high_freq_;
+
+  uint32_t char_time_us_{1146};
+  uint32_t frame_delay_us_{1750};
+
+  uint32_t stats_start_us_{0};
+  uint32_t busy_us_{0};
+  float bus_utilization_{0.0f};
 };
 
 class ModbusDevice {
@@ -56,13 +97,26 @@ class ModbusDevice {
   }
   void send_raw(const std::vector<uint8_t> &payload) { this->parent_->send_raw(payload); }
   // If more than one device is connected block sending a new command before a response is received
-  bool waiting_for_response() { return parent_->waiting_for_response != 0; }
+  bool waiting_for_response() { return parent_->is_waiting_for(this->address_); }
+  /** Called by the bus when it is free for this device's turn.
+   *
+   * Devices with queued requests send the next one and return true; returning false passes the turn to the next
+   * device on the bus.
+   */
+  virtual bool on_modbus_idle() { return false; }
+
+  /// Average time from sending a request to receiving its response, in ms.
+  float get_average_latency() const { return this->average_latency_; }
 
  protected:
   friend Modbus;
 
   Modbus *parent_;
   uint8_t address_;
+
+  float average_latency_{0.0f};
+  uint32_t responses_{0};
+  uint32_t timeouts_{0};
 };
 
 }  // namespace modbus
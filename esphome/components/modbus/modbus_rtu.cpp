@@ -0,0 +1,169 @@
+#include "modbus_rtu.h"
+
+#ifdef USE_MODBUS_RTU
+
+#include "esphome/core/log.h"
+#include "esphome/core/helpers.h"
+
+#include <cinttypes>
+
+namespace esphome {
+namespace modbus {
+
+static const char *const TAG = "modbus.rtu";
+
+// The UART drivers may hold received bytes back for up to this many character times before handing them over
+static const uint32_t RX_LATENCY_CHARS = 10;
+
+void ModbusRtu::setup() {
+  if (this->flow_control_pin_ != nullptr) {
+    this->flow_control_pin_->setup();
+  }
+
+  // One character is a start bit, the data bits, the parity bit and the stop bits. Above 19200 baud the spec fixes
+  // the silent interval between frames at 1750 µs instead of 3.5 characters.
+  const uint32_t baud_rate = this->parent_->get_baud_rate();
+  const bool parity = this->parent_->get_parity() != uart::UART_CONFIG_PARITY_NONE;
+  const uint32_t bits = 1 + this->parent_->get_data_bits() + parity + this->parent_->get_stop_bits();
+  this->char_time_us_ = (bits * 1000000 + baud_rate - 1) / baud_rate;
+  this->frame_delay_us_ = baud_rate > 19200 ? 1750 : this->char_time_us_ * 7 / 2;
+  this->frame_timeout_us_ = this->frame_delay_us_ + RX_LATENCY_CHARS * this->char_time_us_;
+
+  Modbus::setup();
+}
+
+void ModbusRtu::receive_(uint32_t now) {
+  bool received = false;
+  const uint8_t *data;
+  while (size_t len = this->peek_span(&data)) {
+    for (size_t i = 0; i < len; i++) {
+      if (!this->parse_modbus_byte_(data[i]))
+        this->rx_buffer_.clear();
+    }
+    this->consume(len);
+    received = true;
+  }
+  if (received) {
+    this->last_activity_us_ = now;
+  } else if (!this->rx_buffer_.empty() && now - this->last_activity_us_ > this->frame_timeout_us_) {
+    // The line went silent in the middle of a frame
+    ESP_LOGV(TAG, "Dropping incomplete frame of %zu bytes", this->rx_buffer_.size());
+    this->rx_buffer_.clear();
+  }
+}
+
+bool ModbusRtu::parse_modbus_byte_(uint8_t byte) {
+  size_t at = this->rx_buffer_.size();
+  this->rx_buffer_.push_back(byte);
+  const uint8_t *raw = &this->rx_buffer_[0];
+  ESP_LOGV(TAG, "Modbus received Byte  %d (0X%x)", byte, byte);
+  // Byte 0: modbus address (match all)
+  if (at == 0)
+    return true;
+  uint8_t address = raw[0];
+  uint8_t function_code = raw[1];
+  // Byte 2: Size (with modbus rtu function code 4/3)
+  // See also https://en.wikipedia.org/wiki/Modbus
+  if (at == 2)
+    return true;
+
+  uint8_t data_len = raw[2];
+  uint8_t data_offset = 3;
+
+  // Per https://modbus.org/docs/Modbus_Application_Protocol_V1_1b3.pdf Ch 5 User-Defined function codes
+  if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
+    // Handle user-defined function, since we don't know how big this ought to be,
+    // ideally we should delegate the entire length detection to whatever handler is
+    // installed, but wait, there is the CRC, and if we get a hit there is a good
+    // chance that this is a complete message ... admittedly there is a small chance is
+    // isn't but that is quite small given the purpose of the CRC in the first place
+
+    // Fewer than 2 bytes can't calc CRC
+    if (at < 2)
+      return true;
+
+    data_len = at - 2;
+    data_offset = 1;
+
+    uint16_t computed_crc = crc16(raw, data_offset + data_len);
+    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
+
+    if (computed_crc != remote_crc)
+      return true;
+
+    ESP_LOGD(TAG, "Modbus user-defined function %02X found", function_code);
+
+  } else {
+    // the response for write command mirrors the requests and data startes at offset 2 instead of 3 for read commands
+    if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
+      data_offset = 2;
+      data_len = 4;
+    }
+
+    // Error ( msb indicates error )
+    // response format:  Byte[0] = device address, Byte[1] function code | 0x80 , Byte[2] exception code, Byte[3-4] crc
+    if ((function_code & 0x80) == 0x80) {
+      data_offset = 2;
+      data_len = 1;
+    }
+
+    // Byte data_offset..data_offset+data_len-1: Data
+    if (at < data_offset + data_len)
+      return true;
+
+    // Byte 3+data_len: CRC_LO (over all bytes)
+    if (at == data_offset + data_len)
+      return true;
+
+    // Byte data_offset+len+1: CRC_HI (over all bytes)
+    uint16_t computed_crc = crc16(raw, data_offset + data_len);
+    uint16_t remote_crc = uint16_t(raw[data_offset + data_len]) | (uint16_t(raw[data_offset + data_len + 1]) << 8);
+    if (computed_crc != remote_crc) {
+      if (this->disable_crc_) {
+        ESP_LOGD(TAG, "Modbus CRC Check failed, but ignored! %02X!=%02X", computed_crc, remote_crc);
+      } else {
+        ESP_LOGW(TAG, "Modbus CRC Check failed! %02X!=%02X", computed_crc, remote_crc);
+        return false;
+      }
+    }
+  }
+
+  this->handle_response_(address, function_code, raw + data_offset, data_len, this->transactions_.empty() ? -1 : 0);
+
+  // return false to reset buffer
+  return false;
+}
+
+void ModbusRtu::dump_config() {
+  ESP_LOGCONFIG(TAG, "Modbus RTU:");
+  LOG_PIN("  Flow Control Pin: ", this->flow_control_pin_);
+  ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
+  ESP_LOGCONFIG(TAG, "  Frame Delay: %" PRIu32 " µs", this->frame_delay_us_);
+  ESP_LOGCONFIG(TAG, "  CRC Disabled: %s", YESNO(this->disable_crc_));
+}
+float ModbusRtu::get_setup_priority() const {
+  // After UART bus
+  return setup_priority::BUS - 1.0f;
+}
+
+void ModbusRtu::send_frame_(const std::vector<uint8_t> &frame) {
+  auto crc = crc16(frame.data(), frame.size());
+
+  if (this->flow_control_pin_ != nullptr)
+    this->flow_control_pin_->digital_write(true);
+
+  this->begin_transaction_(frame[0]);
+  this->write_array(frame);
+  this->write_byte(crc & 0xFF);
+  this->write_byte((crc >> 8) & 0xFF);
+  this->flush();
+
+  if (this->flow_control_pin_ != nullptr)
+    this->flow_control_pin_->digital_write(false);
+  this->last_activity_us_ = micros();
+}
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_RTU
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MODBUS_RTU
+
+#include "modbus.h"
+#include "esphome/components/uart/uart.h"
+
+namespace esphome {
+namespace modbus {
+
+/// Modbus RTU over a serial line, with frames separated by silent intervals and protected by a CRC.
+class ModbusRtu : public Modbus, public uart::UARTDevice {
+ public:
+  void setup() override;
+
+  void dump_config() override;
+
+  float get_setup_priority() const override;
+
+  void set_flow_control_pin(GPIOPin *flow_control_pin) { this->flow_control_pin_ = flow_control_pin; }
+  void set_disable_crc(bool disable_crc) { disable_crc_ = disable_crc; }
+
+ protected:
+  void send_frame_(const std::vector<uint8_t> &frame) override;
+  void receive_(uint32_t now) override;
+  /// Requests may only start once the bus has been silent for 3.5 characters.
+  bool can_send_(uint32_t now) override { return now - this->last_activity_us_ >= this->frame_delay_us_; }
+
+  bool parse_modbus_byte_(uint8_t byte);
+
+  GPIOPin *flow_control_pin_{nullptr};
+  bool disable_crc_;
+  std::vector<uint8_t> rx_buffer_;
+
+  /// Time after which an incomplete frame is dropped, in µs.
+  uint32_t frame_timeout_us_{50000};
+  /// Last time a byte was received or a frame was sent.
+  uint32_t last_activity_us_{0};
+};
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_RTU
@@ -0,0 +1,201 @@
+#include "modbus_tcp.h"
+
+#ifdef USE_MODBUS_TCP
+
+#include "esphome/core/log.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/helpers.h"
+
+#include <cerrno>
+#include <cstring>
+
+namespace esphome {
+namespace modbus {
+
+static const char *const TAG = "modbus.tcp";
+
+static const size_t MBAP_HEADER_SIZE = 7;
+static const uint32_t CONNECT_TIMEOUT = 5000;
+static const uint32_t RECONNECT_INTERVAL = 5000;
+
+ModbusTcp::ModbusTcp() {
+  // Responses are matched by transaction identifier and there is no silent interval between frames
+  this->pipelined_ = true;
+  this->char_time_us_ = 1;
+  this->frame_delay_us_ = 0;
+}
+
+void ModbusTcp::loop() {
+  const uint32_t now = millis();
+
+  if (this->socket_ == nullptr) {
+    if (now - this->connect_start_ >= RECONNECT_INTERVAL || this->connect_start_ == 0)
+      this->connect_();
+  } else if (!this->connected_) {
+    struct sockaddr_storage peer;
+    socklen_t peer_len = sizeof(peer);
+    int error = 0;
+    socklen_t error_len = sizeof(error);
+    if (this->socket_->getpeername((struct sockaddr *) &peer, &peer_len) == 0) {
+      ESP_LOGD(TAG, "Connected to %s:%u", this->host_.c_str(), this->port_);
+      this->connected_ = true;
+    } else if (errno != ENOTCONN ||
+               (this->socket_->getsockopt(SOL_SOCKET, SO_ERROR, &error, &error_len) == 0 && error != 0)) {
+      ESP_LOGW(TAG, "Connecting to %s:%u failed", this->host_.c_str(), this->port_);
+      this->disconnect_();
+    } else if (now - this->connect_start_ > CONNECT_TIMEOUT) {
+      ESP_LOGW(TAG, "Connecting to %s:%u timed out", this->host_.c_str(), this->port_);
+      this->disconnect_();
+    }
+  }
+
+  Modbus::loop();
+}
+
+void ModbusTcp::connect_() {
+  this->connect_start_ = millis();
+  this->socket_ = socket::socket_ip(SOCK_STREAM, IPPROTO_TCP);
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Could not create socket");
+    return;
+  }
+  int enable = 1;
+  this->socket_->setsockopt(IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(int));
+  if (this->socket_->setblocking(false) != 0) {
+    ESP_LOGW(TAG, "Socket unable to set nonblocking mode: errno %d", errno);
+    this->socket_ = nullptr;
+    return;
+  }
+
+  struct sockaddr_storage server;
+  socklen_t sl = socket::set_sockaddr((struct sockaddr *) &server, sizeof(server), this->host_, this->port_);
+  if (sl == 0 || (this->socket_->connect((struct sockaddr *) &server, sl) != 0 && errno != EINPROGRESS)) {
+    ESP_LOGW(TAG, "Connecting to %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+    this->socket_ = nullptr;
+  }
+}
+
+void ModbusTcp::disconnect_() {
+  this->socket_ = nullptr;
+  this->connected_ = false;
+  this->rx_len_ = 0;
+  // The responses to the pending requests are lost with the connection
+  const uint32_t now = micros();
+  while (!this->transactions_.empty())
+    this->end_transaction_(this->transactions_.size() - 1, now, false);
+}
+
+void ModbusTcp::receive_(uint32_t now) {
+  if (!this->connected_)
+    return;
+
+  while (true) {
+    ssize_t len = this->socket_->read(this->rx_buffer_ + this->rx_len_, MAX_FRAME_SIZE - this->rx_len_);
+    if (len < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+      return;
+    if (len <= 0) {
+      ESP_LOGW(TAG, "Connection to %s:%u closed: errno %d", this->host_.c_str(), this->port_, len == 0 ? 0 : errno);
+      this->disconnect_();
+      return;
+    }
+    this->rx_len_ += len;
+
+    size_t parsed = this->parse_frames_();
+    if (this->socket_ == nullptr)
+      return;
+    memmove(this->rx_buffer_, this->rx_buffer_ + parsed, this->rx_len_ - parsed);
+    this->rx_len_ -= parsed;
+  }
+}
+
+size_t ModbusTcp::parse_frames_() {
+  size_t at = 0;
+  // A callback may drop the connection while the frames are handled
+  while (this->socket_ != nullptr && this->rx_len_ - at >= MBAP_HEADER_SIZE + 1) {
+    const uint8_t *frame = this->rx_buffer_ + at;
+    const uint16_t transaction_id = encode_uint16(frame[0], frame[1]);
+    const uint16_t protocol_id = encode_uint16(frame[2], frame[3]);
+    const uint16_t length = encode_uint16(frame[4], frame[5]);
+    if (protocol_id != 0 || length < 2 || MBAP_HEADER_SIZE - 1 + length > MAX_FRAME_SIZE) {
+      ESP_LOGW(TAG, "Invalid frame header, reconnecting");
+      this->disconnect_();
+      return 0;
+    }
+    if (this->rx_len_ - at < MBAP_HEADER_SIZE - 1 + length)
+      break;
+    at += MBAP_HEADER_SIZE - 1 + length;
+
+    const uint8_t address = frame[6];
+    const uint8_t *pdu = frame + MBAP_HEADER_SIZE;
+    const size_t pdu_len = length - 1;
+    const uint8_t function_code = pdu[0];
+    const uint8_t *data = pdu + 1;
+    size_t data_len = pdu_len - 1;
+    if ((function_code & 0x80) == 0x80) {
+      data_len = 1;
+    } else if (((function_code >= 65) && (function_code <= 72)) || ((function_code >= 100) && (function_code <= 110))) {
+      // User-defined functions get the whole PDU, as over RTU
+      data = pdu;
+      data_len = pdu_len;
+    } else if (function_code == 0x5 || function_code == 0x06 || function_code == 0xF || function_code == 0x10) {
+      // the response for write command mirrors the request
+      data_len = 4;
+    } else {
+      // Read responses start with the byte count
+      data = pdu + 2;
+      data_len = pdu[1];
+    }
+    if (data + data_len > pdu + pdu_len) {
+      ESP_LOGW(TAG, "Truncated response from 0x%02X", address);
+      continue;
+    }
+
+    int transaction = -1;
+    for (size_t i = 0; i < this->transactions_.size(); i++) {
+      if (this->transactions_[i].id == transaction_id) {
+        transaction = i;
+        break;
+      }
+    }
+    if (transaction < 0) {
+      ESP_LOGD(TAG, "Ignoring response with unknown transaction id %u", transaction_id);
+      continue;
+    }
+    ESP_LOGV(TAG, "Modbus received: %s", format_hex_pretty(frame, MBAP_HEADER_SIZE - 1 + length).c_str());
+    this->handle_response_(address, function_code, data, data_len, transaction);
+  }
+  return at;
+}
+
+void ModbusTcp::send_frame_(const std::vector<uint8_t> &frame) {
+  if (!this->connected_) {
+    ESP_LOGW(TAG, "Not connected to %s:%u, dropping request", this->host_.c_str(), this->port_);
+    return;
+  }
+
+  const uint16_t transaction_id = this->next_transaction_id_++;
+  // MBAP header; the unit identifier is the first byte of the frame
+  std::vector<uint8_t> data = {uint8_t(transaction_id >> 8), uint8_t(transaction_id >> 0), 0, 0,
+                               uint8_t(frame.size() >> 8), uint8_t(frame.size() >> 0)};
+  data.insert(data.end(), frame.begin(), frame.end());
+
+  ssize_t written = this->socket_->write(data.data(), data.size());
+  if (written != ssize_t(data.size())) {
+    ESP_LOGW(TAG, "Writing to %s:%u failed: errno %d", this->host_.c_str(), this->port_, errno);
+    this->disconnect_();
+    return;
+  }
+  this->begin_transaction_(frame[0], transaction_id);
+}
+
+void ModbusTcp::dump_config() {
+  ESP_LOGCONFIG(TAG, "Modbus TCP:");
+  ESP_LOGCONFIG(TAG, "  Server: %s:%u", this->host_.c_str(), this->port_);
+  ESP_LOGCONFIG(TAG, "  Send Wait Time: %d ms", this->send_wait_time_);
+}
+float ModbusTcp::get_setup_priority() const { return setup_priority::AFTER_WIFI; }
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_TCP
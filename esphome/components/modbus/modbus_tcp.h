@@ -0,0 +1,61 @@
+#pragma once
+
+#include "esphome/core/defines.h"
+
+#ifdef USE_MODBUS_TCP
+
+#include "modbus.h"
+#include "esphome/components/socket/socket.h"
+
+#include <memory>
+#include <string>
+
+namespace esphome {
+namespace modbus {
+
+/** Modbus TCP client.
+ *
+ * Frames carry an MBAP header whose transaction identifier matches responses to requests, so requests to different
+ * unit identifiers are pipelined over the one connection instead of waiting for each other.
+ */
+class ModbusTcp : public Modbus {
+ public:
+  ModbusTcp();
+
+  void loop() override;
+
+  void dump_config() override;
+
+  float get_setup_priority() const override;
+
+  void set_host(const std::string &host) { this->host_ = host; }
+  void set_port(uint16_t port) { this->port_ = port; }
+
+ protected:
+  void send_frame_(const std::vector<uint8_t> &frame) override;
+  void receive_(uint32_t now) override;
+  bool can_send_(uint32_t now) override { return this->connected_; }
+
+  void connect_();
+  void disconnect_();
+  /// Handle the complete frames at the start of the receive buffer, returns the number of bytes they took.
+  size_t parse_frames_();
+
+  /// Largest Modbus TCP frame: the 7 byte MBAP header and a 253 byte PDU.
+  static const size_t MAX_FRAME_SIZE = 260;
+
+  std::string host_;
+  uint16_t port_{502};
+  std::unique_ptr<socket::Socket> socket_;
+  bool connected_{false};
+  uint32_t connect_start_{0};
+  uint16_t next_transaction_id_{0};
+
+  uint8_t rx_buffer_[MAX_FRAME_SIZE];
+  size_t rx_len_{0};
+};
+
+}  // namespace modbus
+}  // namespace esphome
+
+#endif  // USE_MODBUS_TCP
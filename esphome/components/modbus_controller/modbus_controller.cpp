@@ -2,24 +2,52 @@
 #include "esphome/core/application.h"
 #include "esphome/core/log.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace modbus_controller {
 
 static const char *const TAG = "modbus_controller";
 
+// Largest number of registers, and of coils or discrete inputs, a single read command may request
+static const uint16_t MAX_RANGE_REGISTERS = 125;
+static const uint16_t MAX_RANGE_BITS = 2000;
+// Bytes of a read request and of its response without the data: address, function code, byte count and CRC
+static const uint32_t READ_FRAME_OVERHEAD_BYTES = 8 + 5;
+// Assumed time a device needs to start responding to a request
+static const uint32_t DEVICE_TURNAROUND_US = 5000;
+
+// Coils and discrete inputs take a bit each in the response, registers two bytes
+static bool is_bit_register(ModbusRegisterType register_type) {
+  return register_type == ModbusRegisterType::COIL || register_type == ModbusRegisterType::DISCRETE_INPUT;
+}
+
+static uint16_t max_range_size(ModbusRegisterType register_type) {
+  return is_bit_register(register_type) ? MAX_RANGE_BITS : MAX_RANGE_REGISTERS;
+}
+
 void ModbusController::setup() {
   // Modbus::setup();
+  // Items with their own update interval are read every n-th update of the controller
+  const uint32_t interval = this->get_update_interval();
+  for (auto *item : this->sensorset_) {
+    if (item->update_interval == 0 || interval == 0)
+      continue;
+    const uint32_t updates = std::max<uint32_t>((item->update_interval + interval / 2) / interval, 1);
+    item->skip_updates = std::min<uint32_t>(updates - 1, UINT16_MAX);
+  }
   this->create_register_ranges_();
 }
 
 /*
  To work with the existing modbus class and avoid polling for responses a command queue is used.
- send_next_command will submit the command at the top of the queue and set the corresponding callback
- to handle the response from the device.
- Once the response has been processed it is removed from the queue and the next command is sent
+ The modbus bus calls send_next_command whenever it's this device's turn; it submits the command at the top of the
+ queue and sets the corresponding callback to handle the response from the device.
+ Once the response has been received it is removed from the queue and the next command is sent
 */
 bool ModbusController::send_next_command_() {
   uint32_t last_send = millis() - this->last_command_timestamp_;
+  bool sent = false;
 
   if ((last_send > this->command_throttle_) && !waiting_for_response() && !command_queue_.empty()) {
     auto &command = command_queue_.front();
@@ -46,6 +74,7 @@ bool ModbusController::send_next_command_() {
       ESP_LOGV(TAG, "Sending next modbus command to device %d register 0x%02X count %d", this->address_,
                command->register_address, command->register_count);
       command->send();
+      sent = true;
       this->last_command_timestamp_ = millis();
       // remove from queue if no handler is defined
       if (!command->on_data_func) {
@@ -53,7 +82,7 @@ bool ModbusController::send_next_command_() {
       }
     }
   }
-  return (!command_queue_.empty());
+  return sent;
 }
 
 // Queue incoming response
@@ -198,7 +227,7 @@ size_t ModbusController::create_register_ranges_() {
   // iterator is sorted see SensorItemsComparator for details
   auto ix = sensorset_.begin();
   RegisterRange r = {};
-  uint8_t buffer_offset = 0;
+  uint16_t buffer_offset = 0;
   SensorItem *prev = nullptr;
   while (ix != sensorset_.end()) {
     SensorItem *curr = *ix;
@@ -238,16 +267,22 @@ size_t ModbusController::create_register_ranges_() {
 
           ESP_LOGV(TAG, "Re-use previous register - change to register: 0x%X %d offset=%u", curr->start_address,
                    curr->register_count, curr->offset);
-        } else if (curr->start_address == (r.start_address + r.register_count)) {
-          // this register can extend the current range
+        } else if (curr->start_address >= (r.start_address + r.register_count) &&
+                   curr->start_address + curr->register_count <= r.start_address + max_range_size(r.register_type) &&
+                   (curr->start_address == (r.start_address + r.register_count) ||
+                    this->bridge_gap_(r, curr, curr->start_address - (r.start_address + r.register_count)))) {
+          // this register can extend the current range, possibly by reading a few unused registers in between
+          const uint16_t gap = curr->start_address - (r.start_address + r.register_count);
+          const uint16_t gap_size = is_bit_register(r.register_type) ? gap : gap * 2;
 
           // remove this sensore because start_address is changed (sort-order)
           ix = sensorset_.erase(ix);
 
           curr->start_address = r.start_address;
-          curr->offset += buffer_offset;
-          buffer_offset += curr->get_register_size();
-          r.register_count += curr->register_count;
+          curr->offset += buffer_offset + gap_size;
+          buffer_offset += gap_size + curr->get_register_size();
+          r.register_count += gap + curr->register_count;
+          r.unused_registers += gap;
 
           sensorset_.insert(curr);
           // move iterator backwards because it will be incremented later
@@ -294,9 +329,35 @@ size_t ModbusController::create_register_ranges_() {
   return register_ranges_.size();
 }
 
+bool ModbusController::bridge_gap_(const RegisterRange &r, const SensorItem *item, uint16_t gap) const {
+  // Don't read registers of a slowly updated item on every update of a faster one
+  if (gap > this->max_register_gap_ || item->skip_updates != r.skip_updates)
+    return false;
+  const uint32_t gap_bytes = is_bit_register(r.register_type) ? (gap + 7) / 8 : gap * 2u;
+  return gap_bytes * this->parent_->get_char_time_us() < this->estimate_request_time_us_();
+}
+
+uint32_t ModbusController::estimate_request_time_us_() const {
+  return READ_FRAME_OVERHEAD_BYTES * this->parent_->get_char_time_us() + 2 * this->parent_->get_frame_delay_us() +
+         DEVICE_TURNAROUND_US + this->command_throttle_ * 1000u;
+}
+
+uint32_t ModbusController::estimate_range_time_us_(const RegisterRange &r) const {
+  const uint32_t data_bytes = is_bit_register(r.register_type) ? (r.register_count + 7) / 8 : r.register_count * 2u;
+  return this->estimate_request_time_us_() + data_bytes * this->parent_->get_char_time_us();
+}
+
 void ModbusController::dump_config() {
   ESP_LOGCONFIG(TAG, "ModbusController:");
   ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
+  if (this->max_register_gap_ > 0)
+    ESP_LOGCONFIG(TAG, "  Max Register Gap: %u", this->max_register_gap_);
+  // Ranges that skip updates only take their share of the bus time of an update
+  float bus_time_ms = 0.0f;
+  for (auto &it : register_ranges_)
+    bus_time_ms += this->estimate_range_time_us_(it) / 1000.0f / (it.skip_updates + 1);
+  ESP_LOGCONFIG(TAG, "  Register Ranges: %zu, estimated bus time per update: %.1f ms", register_ranges_.size(),
+                bus_time_ms);
 #if ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE
   ESP_LOGCONFIG(TAG, "sensormap");
   for (auto &it : sensorset_) {
@@ -306,23 +367,21 @@ void ModbusController::dump_config() {
   }
   ESP_LOGCONFIG(TAG, "ranges");
   for (auto &it : register_ranges_) {
-    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d skip_updates=%d", static_cast<uint8_t>(it.register_type),
-                  it.start_address, it.register_count, it.skip_updates);
+    ESP_LOGCONFIG(TAG, "  Range type=%zu start=0x%X count=%d unused=%d skip_updates=%d estimate=%" PRIu32 " us",
+                  static_cast<uint8_t>(it.register_type), it.start_address, it.register_count, it.unused_registers,
+                  it.skip_updates, this->estimate_range_time_us_(it));
   }
 #endif
 }
 
 void ModbusController::loop() {
-  // Incoming data to process?
+  // Incoming data to process? Commands are sent when the bus asks for them, so the next request is already on its
+  // way while this response is processed.
   if (!incoming_queue_.empty()) {
     auto &message = incoming_queue_.front();
     if (message != nullptr)
       process_modbus_data_(message.get());
     incoming_queue_.pop();
-
-  } else {
-    // all messages processed send pending commands
-    send_next_command_();
   }
 }
 
@@ -239,14 +239,18 @@ class SensorItem {
   }
   // Override register size for modbus devices not using 1 register for one dword
   void set_register_size(uint8_t register_size) { response_bytes = register_size; }
+  // Poll the register at its own interval instead of every skip_updates + 1 updates of the controller
+  void set_update_interval(uint32_t update_interval) { this->update_interval = update_interval; }
   ModbusRegisterType register_type;
   SensorValueType sensor_value_type;
   uint16_t start_address;
   uint32_t bitmask;
-  uint8_t offset;
+  // Byte offset in the response, or bit offset for coils and discrete inputs
+  uint16_t offset;
   uint8_t register_count;
   uint8_t response_bytes{0};
   uint16_t skip_updates;
+  uint32_t update_interval{0};
   std::vector<uint8_t> custom_data{};
   bool force_new_range{false};
 };
@@ -287,10 +291,11 @@ using SensorSet = std::set<SensorItem *, SensorItemsComparator>;
 struct RegisterRange {
   uint16_t start_address;
   ModbusRegisterType register_type;
-  uint8_t register_count;
+  uint16_t register_count;
   uint16_t skip_updates;          // the config value
   SensorSet sensors;              // all sensors of this range
   uint16_t skip_updates_counter;  // the running value
+  uint16_t unused_registers;      // registers read only to join the sensors into one request
 };
 
 class ModbusCommandItem {
@@ -422,6 +427,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void on_modbus_data(const std::vector<uint8_t> &data) override;
   /// called when a modbus error response was received
   void on_modbus_error(uint8_t function_code, uint8_t exception_code) override;
+  /// called by the modbus bus when it's this device's turn to send
+  bool on_modbus_idle() override { return this->send_next_command_(); }
   /// default delegate called by process_modbus_data when a response has retrieved from the incoming queue
   void on_register_data(ModbusRegisterType register_type, uint16_t start_address, const std::vector<uint8_t> &data);
   /// default delegate called by process_modbus_data when a response for a write response has retrieved from the
@@ -432,6 +439,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   void set_command_throttle(uint16_t command_throttle) { this->command_throttle_ = command_throttle; }
   /// called by esphome generated code to set the offline_skip_updates
   void set_offline_skip_updates(uint16_t offline_skip_updates) { this->offline_skip_updates_ = offline_skip_updates; }
+  /// called by esphome generated code to set the largest number of unused registers read to join two ranges
+  void set_max_register_gap(uint16_t max_register_gap) { this->max_register_gap_ = max_register_gap; }
   /// get the number of queued modbus commands (should be mostly empty)
   size_t get_command_queue_length() { return command_queue_.size(); }
   /// get if the module is offline, didn't respond the last command
@@ -440,13 +449,19 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
  protected:
   /// parse sensormap_ and create range of sequential addresses
   size_t create_register_ranges_();
+  /// whether reading `gap` unused registers to add `item` to the range is cheaper than a separate request
+  bool bridge_gap_(const RegisterRange &r, const SensorItem *item, uint16_t gap) const;
+  /// estimated bus time of one request, without the data bytes of the response
+  uint32_t estimate_request_time_us_() const;
+  /// estimated bus time of reading the range
+  uint32_t estimate_range_time_us_(const RegisterRange &r) const;
   // find register in sensormap. Returns iterator with all registers having the same start address
   SensorSet find_sensors_(ModbusRegisterType register_type, uint16_t start_address) const;
   /// submit the read command for the address range to the send queue
   void update_range_(RegisterRange &r);
   /// parse incoming modbus data
   void process_modbus_data_(const ModbusCommandItem *response);
-  /// send the next modbus command from the send queue
+  /// send the next modbus command from the send queue, returns true if a command was sent
   bool send_next_command_();
   /// dump the parsed sensormap for diagnostics
   void dump_sensors_();
@@ -466,6 +481,8 @@ class ModbusController : public PollingComponent, public modbus::ModbusDevice {
   bool module_offline_;
   /// how many updates to skip if module is offline
   uint16_t offline_skip_updates_;
+  /// largest number of unused registers that may be read to join two ranges
+  uint16_t max_register_gap_{0};
 };
 
 /** Convert vector<uint8_t> response payload to float.
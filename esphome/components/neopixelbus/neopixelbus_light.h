@@ -86,6 +86,7 @@ class NeoPixelBusLightOutputBase : public light::AddressableLight {
     this->controller_->Dirty();
 
     this->controller_->Show();
+    this->record_frame_shown_();
   }
 
   float get_setup_priority() const override { return setup_priority::HARDWARE; }
@@ -23,6 +23,7 @@ CONF_TOUCH_SLEEP_TIMEOUT = "touch_sleep_timeout"
 CONF_WAKE_UP_PAGE = "wake_up_page"
 CONF_START_UP_PAGE = "start_up_page"
 CONF_AUTO_WAKE_ON_TOUCH = "auto_wake_on_touch"
+CONF_MAX_QUEUE_SIZE = "max_queue_size"
 CONF_WAVE_MAX_LENGTH = "wave_max_length"
 CONF_BACKGROUND_COLOR = "background_color"
 CONF_BACKGROUND_PRESSED_COLOR = "background_pressed_color"
@@ -20,6 +20,7 @@ from .base_component import (
     CONF_WAKE_UP_PAGE,
     CONF_START_UP_PAGE,
     CONF_AUTO_WAKE_ON_TOUCH,
+    CONF_MAX_QUEUE_SIZE,
 )
 
 CODEOWNERS = ["@senexcrenshaw"]
@@ -62,6 +63,7 @@ CONFIG_SCHEMA = (
             cv.Optional(CONF_WAKE_UP_PAGE): cv.positive_int,
             cv.Optional(CONF_START_UP_PAGE): cv.positive_int,
             cv.Optional(CONF_AUTO_WAKE_ON_TOUCH, default=True): cv.boolean,
+            cv.Optional(CONF_MAX_QUEUE_SIZE, default=64): cv.int_range(min=8, max=255),
         }
     )
     .extend(cv.polling_component_schema("5s"))
@@ -103,6 +105,8 @@ async def to_code(config):
     if CONF_AUTO_WAKE_ON_TOUCH in config:
         cg.add(var.set_auto_wake_on_touch_internal(config[CONF_AUTO_WAKE_ON_TOUCH]))
 
+    cg.add(var.set_max_queue_size(config[CONF_MAX_QUEUE_SIZE]))
+
     await display.register_display(var, config)
 
     for conf in config.get(CONF_ON_SETUP, []):
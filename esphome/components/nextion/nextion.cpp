@@ -3,12 +3,30 @@
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <cstring>
+
 namespace esphome {
 namespace nextion {
 
 static const char *const TAG = "nextion";
 
+static const size_t RX_BUFFER_SIZE = 1024;
+static const size_t MAX_COMMAND_LENGTH = 256;
+/// Room in the command buffer for each queue entry; longer commands share the room of shorter ones.
+static const size_t AVERAGE_COMMAND_LENGTH = 24;
+/// Commands written to the Nextion before waiting for responses, which keeps its serial buffer from overflowing.
+static const size_t MAX_COMMANDS_IN_FLIGHT = 8;
+static const uint32_t STATS_INTERVAL = 60000;
+
 void Nextion::setup() {
+  this->rx_buffer_.resize(RX_BUFFER_SIZE);
+  this->nextion_queue_.resize(this->max_queue_size_);
+  this->command_buffer_.resize(this->max_queue_size_ * AVERAGE_COMMAND_LENGTH + MAX_COMMAND_LENGTH);
+  this->set_interval("stats", STATS_INTERVAL, [this]() { this->log_stats_(); });
+
   this->is_setup_ = false;
   this->ignore_is_setup_ = true;
 
@@ -110,12 +128,15 @@ bool Nextion::check_connect_() {
 }
 
 void Nextion::reset_(bool reset_nextion) {
-  uint8_t d;
-
-  while (this->available()) {  // Clear receive buffer
-    this->read_byte(&d);
-  };
-  this->nextion_queue_.clear();
+  const uint8_t *data;
+  while (size_t len = this->peek_span(&data)) {  // Clear receive buffer
+    this->consume(len);
+  }
+  this->rx_length_ = 0;
+  this->queue_head_ = 0;
+  this->queue_count_ = 0;
+  this->queue_sent_ = 0;
+  this->queue_in_flight_ = 0;
   this->waveform_queue_.clear();
 }
 
@@ -138,6 +159,8 @@ void Nextion::dump_config() {
   if (this->start_up_page_ != -1) {
     ESP_LOGCONFIG(TAG, "  Start Up Page :      %d", this->start_up_page_);
   }
+
+  ESP_LOGCONFIG(TAG, "  Max Queue Size:   %zu", this->max_queue_size_);
 }
 
 float Nextion::get_setup_priority() const { return setup_priority::DATA; }
@@ -188,37 +211,25 @@ bool Nextion::send_command_printf(const char *format, ...) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return false;
 
-  char buffer[256];
   va_list arg;
   va_start(arg, format);
-  int ret = vsnprintf(buffer, sizeof(buffer), format, arg);
+  bool queued = this->queue_vprintf_("send_command_printf", nullptr, false, format, arg);
   va_end(arg);
-  if (ret <= 0) {
-    ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
-    return false;
-  }
-
-  if (this->send_command_(buffer)) {
-    this->add_no_result_to_queue_("send_command_printf");
-    return true;
-  }
-  return false;
+  return queued;
 }
 
 #ifdef NEXTION_PROTOCOL_LOG
 void Nextion::print_queue_members_() {
-  ESP_LOGN(TAG, "print_queue_members_ (top 10) size %zu", this->nextion_queue_.size());
+  ESP_LOGN(TAG, "print_queue_members_ (top 10) size %zu, sent %zu", this->queue_count_, this->queue_sent_);
   ESP_LOGN(TAG, "*******************************************");
-  int count = 0;
-  for (auto *i : this->nextion_queue_) {
-    if (count++ == 10)
-      break;
-
-    if (i == nullptr) {
-      ESP_LOGN(TAG, "Nextion queue is null");
+  for (size_t i = 0; i < this->queue_count_ && i < 10; i++) {
+    const NextionQueue &entry = this->queue_at_(i);
+    if (entry.component == nullptr) {
+      ESP_LOGN(TAG, "Nextion queue type: NO_RESULT, command: %.*s", entry.command_length,
+               &this->command_buffer_[entry.command_start]);
     } else {
-      ESP_LOGN(TAG, "Nextion queue type: %d:%s , name: %s", i->component->get_queue_type(),
-               i->component->get_queue_type_string().c_str(), i->component->get_variable_name().c_str());
+      ESP_LOGN(TAG, "Nextion queue type: %d:%s , name: %s", entry.component->get_queue_type(),
+               entry.component->get_queue_type_string().c_str(), entry.component->get_variable_name().c_str());
     }
   }
   ESP_LOGN(TAG, "*******************************************");
@@ -256,6 +267,7 @@ void Nextion::loop() {
 
   this->process_serial_();            // Receive serial data
   this->process_nextion_commands_();  // Process nextion return commands
+  this->send_queued_commands_();
 
   if (!this->nextion_reports_is_setup_) {
     if (this->started_ms_ == 0)
@@ -269,62 +281,179 @@ void Nextion::loop() {
 }
 
 bool Nextion::remove_from_q_(bool report_empty) {
-  if (this->nextion_queue_.empty()) {
+  if (this->queue_in_flight_ == 0) {
     if (report_empty) {
       ESP_LOGE(TAG, "Nextion queue is empty!");
     }
     return false;
   }
 
-  NextionQueue *nb = this->nextion_queue_.front();
-  NextionComponentBase *component = nb->component;
+  const NextionQueue &entry = this->queue_at_(0);
+  if (entry.component == nullptr) {
+    ESP_LOGN(TAG, "Removing %.*s from the queue", entry.command_length, &this->command_buffer_[entry.command_start]);
+  } else {
+    ESP_LOGN(TAG, "Removing %s from the queue", entry.component->get_variable_name().c_str());
+  }
+
+  if (entry.sleep_wake) {
+    this->is_sleeping_ = false;
+  }
 
-  ESP_LOGN(TAG, "Removing %s from the queue", component->get_variable_name().c_str());
+  const float round_trip = millis() - entry.queue_time;
+  this->average_round_trip_ =
+      this->average_round_trip_ == 0.0f ? round_trip : this->average_round_trip_ * 0.875f + round_trip * 0.125f;
+  this->commands_answered_++;
 
-  if (component->get_queue_type() == NextionQueueType::NO_RESULT) {
-    if (component->get_variable_name() == "sleep_wake") {
-      this->is_sleeping_ = false;
+  this->pop_queue_front_();
+  return true;
+}
+
+void Nextion::pop_queue_front_() {
+  if (this->queue_at_(0).sent)
+    this->queue_in_flight_--;
+  this->queue_head_ = (this->queue_head_ + 1) % this->nextion_queue_.size();
+  this->queue_count_--;
+  this->queue_sent_--;
+
+  // Superseded commands were skipped when sending, drop them once they reach the front
+  while (this->queue_sent_ > 0 && this->queue_at_(0).superseded) {
+    this->queue_head_ = (this->queue_head_ + 1) % this->nextion_queue_.size();
+    this->queue_count_--;
+    this->queue_sent_--;
+  }
+  if (this->queue_count_ == 0)
+    this->command_buffer_write_ = 0;
+}
+
+void Nextion::drop_unsent_commands_() {
+  size_t dropped = 0;
+  for (size_t i = this->queue_sent_; i < this->queue_count_; i++) {
+    NextionQueue &entry = this->queue_at_(i);
+    if (entry.superseded || entry.sleep_wake)
+      continue;
+    // Skipped like superseded commands when it's their turn
+    entry.superseded = true;
+    dropped++;
+  }
+  if (dropped != 0)
+    ESP_LOGD(TAG, "Nextion is sleeping, dropped %zu queued commands", dropped);
+}
+
+void Nextion::send_queued_commands_() {
+  const uint8_t delimiter[3] = {0xFF, 0xFF, 0xFF};
+  const uint32_t now = millis();
+  while (this->queue_sent_ < this->queue_count_ && this->queue_in_flight_ < MAX_COMMANDS_IN_FLIGHT) {
+    NextionQueue &entry = this->queue_at_(this->queue_sent_++);
+    if (entry.superseded) {
+      if (this->queue_sent_ == 1)
+        this->pop_queue_front_();
+      continue;
     }
-    delete component;  // NOLINT(cppcoreguidelines-owning-memory)
+
+    ESP_LOGN(TAG, "send_command %.*s", entry.command_length, &this->command_buffer_[entry.command_start]);
+    this->write_array(reinterpret_cast<const uint8_t *>(&this->command_buffer_[entry.command_start]),
+                      entry.command_length);
+    this->write_array(delimiter, sizeof(delimiter));
+    entry.sent = true;
+    entry.queue_time = now;
+    this->queue_in_flight_++;
   }
-  delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
-  this->nextion_queue_.pop_front();
-  return true;
+}
+
+void Nextion::log_stats_() {
+  if (this->commands_answered_ == 0 && this->commands_dropped_ == 0)
+    return;
+  ESP_LOGD(TAG,
+           "%" PRIu32 " commands answered, %" PRIu32 " coalesced, %" PRIu32 " dropped, max queue depth %" PRIu32
+           ", average round trip %.1f ms",
+           this->commands_answered_, this->commands_coalesced_, this->commands_dropped_, this->queue_max_depth_,
+           this->average_round_trip_);
+  this->commands_answered_ = 0;
+  this->commands_coalesced_ = 0;
+  this->commands_dropped_ = 0;
+  this->queue_max_depth_ = this->queue_count_;
 }
 
 void Nextion::process_serial_() {
-  uint8_t d;
+  const uint8_t *data;
+  while (this->rx_length_ < this->rx_buffer_.size()) {
+    size_t len = this->peek_span(&data);
+    if (len == 0)
+      break;
+    len = std::min(len, this->rx_buffer_.size() - this->rx_length_);
+    memcpy(&this->rx_buffer_[this->rx_length_], data, len);
+    this->rx_length_ += len;
+    this->consume(len);
+  }
+}
 
-  while (this->available()) {
-    read_byte(&d);
-    this->command_data_ += d;
+// Length of the data of the events that always carry the same amount. It may contain 0xFF bytes, so these can't be
+// framed by searching for the delimiter.
+static size_t fixed_event_data_length(uint8_t event) {
+  switch (event) {
+    case 0x65:
+      return 3;
+    case 0x66:
+      return 1;
+    case 0x67:
+    case 0x68:
+      return 5;
+    case 0x71:
+      return 4;
+    default:
+      return 0;
   }
 }
+
+// Length of the first frame in data, including the event byte and the delimiter, or 0 if it is incomplete.
+static size_t find_frame_length(const uint8_t *data, size_t len) {
+  if (len < 4)
+    return 0;
+
+  size_t expected = 0;
+  if (size_t data_length = fixed_event_data_length(data[0])) {
+    expected = 1 + data_length + 3;
+  } else if (data[0] == 0x91) {
+    // Variable name, NUL and a 32 bit value
+    const void *end_of_name = memchr(data + 1, 0, len - 1);
+    if (end_of_name != nullptr)
+      expected = static_cast<const uint8_t *>(end_of_name) - data + 1 + 4 + 3;
+  }
+  if (expected != 0) {
+    if (len < expected)
+      return 0;
+    if (data[expected - 3] == 0xFF && data[expected - 2] == 0xFF && data[expected - 1] == 0xFF)
+      return expected;
+    // Not the frame we expected, fall back to the delimiter
+  }
+
+  for (size_t i = 1; i + 3 <= len; i++) {
+    if (data[i] == 0xFF && data[i + 1] == 0xFF && data[i + 2] == 0xFF)
+      return i + 3;
+  }
+  return 0;
+}
 // nextion.tech/instruction-set/
 void Nextion::process_nextion_commands_() {
-  if (this->command_data_.length() == 0) {
+  if (this->rx_length_ == 0) {
     return;
   }
 
+  size_t frame_length = 0;
   size_t to_process_length = 0;
   std::string to_process;
 
-  ESP_LOGN(TAG, "this->command_data_ %s length %d", this->command_data_.c_str(), this->command_data_.length());
+  ESP_LOGN(TAG, "Received data length %zu", this->rx_length_);
 #ifdef NEXTION_PROTOCOL_LOG
   this->print_queue_members_();
 #endif
-  while ((to_process_length = this->command_data_.find(COMMAND_DELIMITER)) != std::string::npos) {
-    ESP_LOGN(TAG, "print_queue_members_ size %zu", this->nextion_queue_.size());
-    while (to_process_length + COMMAND_DELIMITER.length() < this->command_data_.length() &&
-           static_cast<uint8_t>(this->command_data_[to_process_length + COMMAND_DELIMITER.length()]) == 0xFF) {
-      ++to_process_length;
-      ESP_LOGN(TAG, "Add extra 0xFF to process");
-    }
+  while ((frame_length = find_frame_length(this->rx_buffer_.data(), this->rx_length_)) != 0) {
+    ESP_LOGN(TAG, "print_queue_members_ size %zu", this->queue_count_);
 
-    this->nextion_event_ = this->command_data_[0];
+    this->nextion_event_ = this->rx_buffer_[0];
 
-    to_process_length -= 1;
-    to_process = this->command_data_.substr(1, to_process_length);
+    to_process_length = frame_length - 4;
+    to_process.assign(reinterpret_cast<const char *>(&this->rx_buffer_[1]), to_process_length);
 
     switch (this->nextion_event_) {
       case 0x00:  // instruction sent by user has failed
@@ -335,11 +464,11 @@ void Nextion::process_nextion_commands_() {
       case 0x01:  // instruction sent by user was successful
 
         ESP_LOGVV(TAG, "instruction sent by user was successful");
-        ESP_LOGN(TAG, "this->nextion_queue_.empty() %s", this->nextion_queue_.empty() ? "True" : "False");
+        ESP_LOGN(TAG, "Nextion queue empty %s", this->queue_count_ == 0 ? "True" : "False");
 
         this->remove_from_q_();
         if (!this->is_setup_) {
-          if (this->nextion_queue_.empty()) {
+          if (this->queue_count_ == 0) {
             ESP_LOGD(TAG, "Nextion is setup");
             this->is_setup_ = true;
             this->setup_callback_.call();
@@ -377,8 +506,7 @@ void Nextion::process_nextion_commands_() {
           ESP_LOGW(TAG,
                    "Nextion reported invalid Waveform ID or Channel # was used but no waveform sensor in queue found!");
         } else {
-          auto &nb = this->waveform_queue_.front();
-          NextionComponentBase *component = nb->component;
+          NextionComponentBase *component = this->waveform_queue_.front();
 
           ESP_LOGW(TAG, "Nextion reported invalid Waveform ID %d or Channel # %d was used!",
                    component->get_component_id(), component->get_wave_channel_id());
@@ -386,7 +514,6 @@ void Nextion::process_nextion_commands_() {
           ESP_LOGN(TAG, "Removing waveform from queue with component id %d and waveform id %d",
                    component->get_component_id(), component->get_wave_channel_id());
 
-          delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
           this->waveform_queue_.pop_front();
         }
         break;
@@ -475,25 +602,22 @@ void Nextion::process_nextion_commands_() {
       //  data: ab123
       case 0x70:  // string variable data return
       {
-        if (this->nextion_queue_.empty()) {
+        if (this->queue_in_flight_ == 0) {
           ESP_LOGW(TAG, "ERROR: Received string return but the queue is empty");
           break;
         }
 
-        NextionQueue *nb = this->nextion_queue_.front();
-        NextionComponentBase *component = nb->component;
+        NextionComponentBase *component = this->queue_at_(0).component;
 
-        if (component->get_queue_type() != NextionQueueType::TEXT_SENSOR) {
-          ESP_LOGE(TAG, "ERROR: Received string return but next in queue \"%s\" is not a text sensor",
-                   component->get_variable_name().c_str());
+        if (component == nullptr || component->get_queue_type() != NextionQueueType::TEXT_SENSOR) {
+          ESP_LOGE(TAG, "ERROR: Received string return but next in queue is not a text sensor");
         } else {
           ESP_LOGN(TAG, "Received get_string response: \"%s\" for component id: %s, type: %s", to_process.c_str(),
                    component->get_variable_name().c_str(), component->get_queue_type_string().c_str());
           component->set_state_from_string(to_process, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
-        this->nextion_queue_.pop_front();
+        this->remove_from_q_();
 
         break;
       }
@@ -504,13 +628,13 @@ void Nextion::process_nextion_commands_() {
         //  data: 67305985
       case 0x71:  // numeric variable data return
       {
-        if (this->nextion_queue_.empty()) {
+        if (this->queue_in_flight_ == 0) {
           ESP_LOGE(TAG, "ERROR: Received numeric return but the queue is empty");
           break;
         }
 
-        if (to_process_length == 0) {
-          ESP_LOGE(TAG, "ERROR: Received numeric return but no data!");
+        if (to_process_length != 4) {
+          ESP_LOGE(TAG, "ERROR: Received numeric return with %zu bytes of data instead of 4", to_process_length);
           break;
         }
 
@@ -523,12 +647,13 @@ void Nextion::process_nextion_commands_() {
           ++dataindex;
         }
 
-        NextionQueue *nb = this->nextion_queue_.front();
-        NextionComponentBase *component = nb->component;
+        NextionComponentBase *component = this->queue_at_(0).component;
 
-        if (component->get_queue_type() != NextionQueueType::SENSOR &&
-            component->get_queue_type() != NextionQueueType::BINARY_SENSOR &&
-            component->get_queue_type() != NextionQueueType::SWITCH) {
+        if (component == nullptr) {
+          ESP_LOGE(TAG, "ERROR: Received numeric return but next in queue is not a sensor");
+        } else if (component->get_queue_type() != NextionQueueType::SENSOR &&
+                   component->get_queue_type() != NextionQueueType::BINARY_SENSOR &&
+                   component->get_queue_type() != NextionQueueType::SWITCH) {
           ESP_LOGE(TAG, "ERROR: Received numeric return but next in queue \"%s\" is not a valid sensor type %d",
                    component->get_variable_name().c_str(), component->get_queue_type());
         } else {
@@ -538,8 +663,7 @@ void Nextion::process_nextion_commands_() {
           component->set_state_from_int(value, true, false);
         }
 
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
-        this->nextion_queue_.pop_front();
+        this->remove_from_q_();
 
         break;
       }
@@ -547,6 +671,7 @@ void Nextion::process_nextion_commands_() {
       case 0x86: {  // device automatically enters into sleep mode
         ESP_LOGVV(TAG, "Received Nextion entering sleep automatically");
         this->is_sleeping_ = true;
+        this->drop_unsent_commands_();
         this->sleep_callback_.call();
         break;
       }
@@ -700,8 +825,7 @@ void Nextion::process_nextion_commands_() {
           break;
         }
 
-        auto &nb = this->waveform_queue_.front();
-        auto *component = nb->component;
+        auto *component = this->waveform_queue_.front();
         size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
                                                                         : 255;  // ADDT command can only send 255
 
@@ -711,7 +835,6 @@ void Nextion::process_nextion_commands_() {
                  component->get_component_id(), component->get_wave_channel_id(), buffer_to_send);
 
         component->clear_wave_buffer(buffer_to_send);
-        delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
         this->waveform_queue_.pop_front();
         break;
       }
@@ -720,46 +843,33 @@ void Nextion::process_nextion_commands_() {
         break;
     }
 
-    // ESP_LOGN(TAG, "nextion_event_ deleting from 0 to %d", to_process_length + COMMAND_DELIMITER.length() + 1);
-    this->command_data_.erase(0, to_process_length + COMMAND_DELIMITER.length() + 1);
-    // App.feed_wdt(); Remove before master merge
+    this->rx_length_ -= frame_length;
+    memmove(this->rx_buffer_.data(), &this->rx_buffer_[frame_length], this->rx_length_);
     this->process_serial_();
   }
 
-  uint32_t ms = millis();
-
-  if (!this->nextion_queue_.empty() && this->nextion_queue_.front()->queue_time + this->max_q_age_ms_ < ms) {
-    for (size_t i = 0; i < this->nextion_queue_.size(); i++) {
-      NextionComponentBase *component = this->nextion_queue_[i]->component;
-      if (this->nextion_queue_[i]->queue_time + this->max_q_age_ms_ < ms) {
-        if (this->nextion_queue_[i]->queue_time == 0) {
-          ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\" queue_time 0",
-                   component->get_queue_type_string().c_str(), component->get_variable_name().c_str());
-        }
-
-        if (component->get_variable_name() == "sleep_wake") {
-          this->is_sleeping_ = false;
-        }
-
-        ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\"", component->get_queue_type_string().c_str(),
-                 component->get_variable_name().c_str());
-
-        if (component->get_queue_type() == NextionQueueType::NO_RESULT) {
-          if (component->get_variable_name() == "sleep_wake") {
-            this->is_sleeping_ = false;
-          }
-          delete component;  // NOLINT(cppcoreguidelines-owning-memory)
-        }
+  if (this->rx_length_ == this->rx_buffer_.size()) {
+    ESP_LOGW(TAG, "Dropping %zu bytes of data without a complete event", this->rx_length_);
+    this->rx_length_ = 0;
+  }
 
-        delete this->nextion_queue_[i];  // NOLINT(cppcoreguidelines-owning-memory)
+  uint32_t ms = millis();
 
-        this->nextion_queue_.erase(this->nextion_queue_.begin() + i);
-        i--;
+  while (this->queue_in_flight_ > 0 && ms - this->queue_at_(0).queue_time > this->max_q_age_ms_) {
+    const NextionQueue &entry = this->queue_at_(0);
+    if (entry.component == nullptr) {
+      ESP_LOGD(TAG, "Removing old queue type \"NO_RESULT\" command \"%.*s\"", entry.command_length,
+               &this->command_buffer_[entry.command_start]);
+    } else {
+      ESP_LOGD(TAG, "Removing old queue type \"%s\" name \"%s\"", entry.component->get_queue_type_string().c_str(),
+               entry.component->get_variable_name().c_str());
+    }
 
-      } else {
-        break;
-      }
+    if (entry.sleep_wake) {
+      this->is_sleeping_ = false;
     }
+
+    this->pop_queue_front_();
   }
   ESP_LOGN(TAG, "Loop End");
   // App.feed_wdt(); Remove before master merge
@@ -906,58 +1016,116 @@ uint16_t Nextion::recv_ret_string_(std::string &response, uint32_t timeout, bool
   return ret;
 }
 
-/**
- * @brief
- *
- * @param variable_name Name for the queue
- */
-void Nextion::add_no_result_to_queue_(const std::string &variable_name) {
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion_queue->component = new nextion::NextionComponentBase;
-  nextion_queue->component->set_variable_name(variable_name);
+// Length of the variable a command like "t0.txt=..." assigns to, or 0 if it isn't a plain assignment.
+static size_t assigned_variable_length(const char *command, size_t length) {
+  for (size_t i = 0; i < length && i <= UINT8_MAX; i++) {
+    const char c = command[i];
+    if (c == '=')
+      return i;
+    if (!isalnum(c) && c != '.' && c != '_')
+      return 0;
+  }
+  return 0;
+}
 
-  nextion_queue->queue_time = millis();
+bool Nextion::queue_vprintf_(const char *variable_name, NextionComponentBase *component, bool coalesce,
+                             const char *format, va_list arg) {
+  // Find room for the longest command in the command buffer, which is filled in queue order and wraps around
+  size_t start = this->command_buffer_write_;
+  bool has_room;
+  if (this->queue_count_ == 0) {
+    start = 0;
+    has_room = this->command_buffer_.size() >= MAX_COMMAND_LENGTH;
+  } else {
+    const size_t front = this->queue_at_(0).command_start;
+    if (start > front) {
+      has_room = this->command_buffer_.size() - start >= MAX_COMMAND_LENGTH;
+      if (!has_room && front > MAX_COMMAND_LENGTH) {
+        start = 0;
+        has_room = true;
+      }
+    } else {
+      has_room = front - start > MAX_COMMAND_LENGTH;
+    }
+  }
+  if (!has_room || this->queue_count_ == this->nextion_queue_.size()) {
+    // Further drops until the next statistics are only counted
+    if (this->commands_dropped_++ == 0)
+      ESP_LOGW(TAG, "Command queue is full, dropping %s", variable_name);
+    return false;
+  }
 
-  this->nextion_queue_.push_back(nextion_queue);
+  char *buffer = &this->command_buffer_[start];
+  int ret = vsnprintf(buffer, MAX_COMMAND_LENGTH, format, arg);
+  if (ret <= 0) {
+    ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
+    return false;
+  }
+  const size_t length = std::min<size_t>(ret, MAX_COMMAND_LENGTH - 1);
+
+  // A component's assignment makes a pending assignment to the same variable pointless. The new one goes to the end of
+  // the queue, so other commands can only be in between if they don't depend on the variable: the search stops at
+  // anything but another component's assignment.
+  const bool sleep_wake = strcmp(variable_name, "sleep_wake") == 0;
+  const size_t assign_length = coalesce ? assigned_variable_length(buffer, length) : 0;
+  if (assign_length != 0) {
+    for (size_t i = this->queue_count_; i > this->queue_sent_; i--) {
+      NextionQueue &pending = this->queue_at_(i - 1);
+      if (pending.superseded)
+        continue;
+      if (pending.assign_length == 0)
+        break;
+      if (pending.assign_length != assign_length ||
+          memcmp(&this->command_buffer_[pending.command_start], buffer, assign_length) != 0)
+        continue;
+
+      this->commands_coalesced_++;
+      pending.superseded = true;
+      if (i == this->queue_count_) {
+        // Nothing is queued after it, so the new one can reuse its slot, which still has room for any command
+        this->queue_count_--;
+        memmove(&this->command_buffer_[pending.command_start], buffer, length);
+        start = pending.command_start;
+        buffer = &this->command_buffer_[start];
+      }
+      break;
+    }
+  }
 
-  ESP_LOGN(TAG, "Add to queue type: NORESULT component %s", nextion_queue->component->get_variable_name().c_str());
+  NextionQueue &entry = this->queue_at_(this->queue_count_++);
+  entry.component = component;
+  entry.queue_time = millis();
+  entry.command_start = start;
+  entry.command_length = length;
+  entry.assign_length = assign_length;
+  entry.sent = false;
+  entry.superseded = false;
+  entry.sleep_wake = sleep_wake;
+  this->command_buffer_write_ = start + length;
+  this->queue_max_depth_ = std::max<uint32_t>(this->queue_max_depth_, this->queue_count_);
+
+  ESP_LOGN(TAG, "Add to queue %s: %.*s", variable_name, length, buffer);
+  return true;
 }
 
-/**
- * @brief
- *
- * @param variable_name Variable name for the queue
- * @param command
- */
-void Nextion::add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command) {
-  if ((!this->is_setup() && !this->ignore_is_setup_) || command.empty())
-    return;
-
-  if (this->send_command_(command)) {
-    this->add_no_result_to_queue_(variable_name);
-  }
+bool Nextion::queue_printf_(const char *variable_name, NextionComponentBase *component, bool coalesce,
+                            const char *format, ...) {
+  va_list arg;
+  va_start(arg, format);
+  bool queued = this->queue_vprintf_(variable_name, component, coalesce, format, arg);
+  va_end(arg);
+  return queued;
 }
 
-bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format,
-                                                               ...) {
+bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const char *variable_name, const char *format, ...) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
     return false;
 
-  char buffer[256];
   va_list arg;
   va_start(arg, format);
-  int ret = vsnprintf(buffer, sizeof(buffer), format, arg);
+  bool queued = this->queue_vprintf_(variable_name, nullptr, false, format, arg);
   va_end(arg);
-  if (ret <= 0) {
-    ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
-    return false;
-  }
-
-  this->add_no_result_to_queue_with_command_(variable_name, buffer);
-  return true;
+  return queued;
 }
 
 /**
@@ -967,22 +1135,26 @@ bool Nextion::add_no_result_to_queue_with_ignore_sleep_printf_(const std::string
  * @param format The printf-style command format, like "vis %s,0"
  * @param ... The format arguments
  */
-bool Nextion::add_no_result_to_queue_with_printf_(const std::string &variable_name, const char *format, ...) {
+bool Nextion::add_no_result_to_queue_with_printf_(const char *variable_name, const char *format, ...) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return false;
 
-  char buffer[256];
   va_list arg;
   va_start(arg, format);
-  int ret = vsnprintf(buffer, sizeof(buffer), format, arg);
+  bool queued = this->queue_vprintf_(variable_name, nullptr, false, format, arg);
   va_end(arg);
-  if (ret <= 0) {
-    ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
+  return queued;
+}
+
+bool Nextion::add_no_result_to_queue_with_set_printf_(const char *variable_name, const char *format, ...) {
+  if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return false;
-  }
 
-  this->add_no_result_to_queue_with_command_(variable_name, buffer);
-  return true;
+  va_list arg;
+  va_start(arg, format);
+  bool queued = this->queue_vprintf_(variable_name, nullptr, true, format, arg);
+  va_end(arg);
+  return queued;
 }
 
 /**
@@ -1001,17 +1173,16 @@ void Nextion::add_no_result_to_queue_with_set(NextionComponentBase *component, i
 
 void Nextion::add_no_result_to_queue_with_set(const std::string &variable_name,
                                               const std::string &variable_name_to_send, int state_value) {
-  this->add_no_result_to_queue_with_set_internal_(variable_name, variable_name_to_send, state_value);
+  this->add_no_result_to_queue_with_set_internal_(variable_name.c_str(), variable_name_to_send.c_str(), state_value,
+                                                  false, true);
 }
 
-void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &variable_name,
-                                                        const std::string &variable_name_to_send, int state_value,
-                                                        bool is_sleep_safe) {
+void Nextion::add_no_result_to_queue_with_set_internal_(const char *variable_name, const char *variable_name_to_send,
+                                                        int state_value, bool is_sleep_safe, bool coalesce) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_ignore_sleep_printf_(variable_name, "%s=%d", variable_name_to_send.c_str(),
-                                                         state_value);
+  this->queue_printf_(variable_name, nullptr, coalesce, "%s=%d", variable_name_to_send, state_value);
 }
 
 /**
@@ -1029,37 +1200,25 @@ void Nextion::add_no_result_to_queue_with_set(NextionComponentBase *component, c
 void Nextion::add_no_result_to_queue_with_set(const std::string &variable_name,
                                               const std::string &variable_name_to_send,
                                               const std::string &state_value) {
-  this->add_no_result_to_queue_with_set_internal_(variable_name, variable_name_to_send, state_value);
+  this->add_no_result_to_queue_with_set_internal_(variable_name.c_str(), variable_name_to_send.c_str(), state_value,
+                                                  false, true);
 }
 
-void Nextion::add_no_result_to_queue_with_set_internal_(const std::string &variable_name,
-                                                        const std::string &variable_name_to_send,
-                                                        const std::string &state_value, bool is_sleep_safe) {
+void Nextion::add_no_result_to_queue_with_set_internal_(const char *variable_name, const char *variable_name_to_send,
+                                                        const std::string &state_value, bool is_sleep_safe,
+                                                        bool coalesce) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || (!is_sleep_safe && this->is_sleeping()))
     return;
 
-  this->add_no_result_to_queue_with_printf_(variable_name, "%s=\"%s\"", variable_name_to_send.c_str(),
-                                            state_value.c_str());
+  this->queue_printf_(variable_name, nullptr, coalesce, "%s=\"%s\"", variable_name_to_send, state_value.c_str());
 }
 
 void Nextion::add_to_get_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_))
     return;
 
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  nextion_queue->component = component;
-  nextion_queue->queue_time = millis();
-
-  ESP_LOGN(TAG, "Add to queue type: %s component %s", component->get_queue_type_string().c_str(),
-           component->get_variable_name().c_str());
-
-  std::string command = "get " + component->get_variable_name_to_send();
-
-  if (this->send_command_(command)) {
-    this->nextion_queue_.push_back(nextion_queue);
-  }
+  this->queue_printf_(component->get_variable_name().c_str(), component, false, "get %s",
+                      component->get_variable_name_to_send().c_str());
 }
 
 /**
@@ -1074,13 +1233,7 @@ void Nextion::add_addt_command_to_queue(NextionComponentBase *component) {
   if ((!this->is_setup() && !this->ignore_is_setup_) || this->is_sleeping())
     return;
 
-  // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
-  nextion::NextionQueue *nextion_queue = new nextion::NextionQueue;
-
-  nextion_queue->component = component;
-  nextion_queue->queue_time = millis();
-
-  this->waveform_queue_.push_back(nextion_queue);
+  this->waveform_queue_.push_back(component);
   if (this->waveform_queue_.size() == 1)
     this->check_pending_waveform_();
 }
@@ -1089,15 +1242,13 @@ void Nextion::check_pending_waveform_() {
   if (this->waveform_queue_.empty())
     return;
 
-  auto *nb = this->waveform_queue_.front();
-  auto *component = nb->component;
+  auto *component = this->waveform_queue_.front();
   size_t buffer_to_send = component->get_wave_buffer_size() < 255 ? component->get_wave_buffer_size()
                                                                   : 255;  // ADDT command can only send 255
 
   std::string command = "addt " + to_string(component->get_component_id()) + "," +
                         to_string(component->get_wave_channel_id()) + "," + to_string(buffer_to_send);
   if (!this->send_command_(command)) {
-    delete nb;  // NOLINT(cppcoreguidelines-owning-memory)
     this->waveform_queue_.pop_front();
   }
 }
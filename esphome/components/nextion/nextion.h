@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdarg>
 #include <deque>
 #include <vector>
 
@@ -770,10 +771,42 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
   void set_wake_up_page_internal(uint8_t wake_up_page) { this->wake_up_page_ = wake_up_page; }
   void set_start_up_page_internal(uint8_t start_up_page) { this->start_up_page_ = start_up_page; }
   void set_auto_wake_on_touch_internal(bool auto_wake_on_touch) { this->auto_wake_on_touch_ = auto_wake_on_touch; }
+  /// Set how many commands may wait to be sent or for their response; further commands are dropped.
+  void set_max_queue_size(size_t max_queue_size) { this->max_queue_size_ = max_queue_size; }
+
+  /// Number of commands waiting to be sent or for their response.
+  size_t get_queue_depth() const { return this->queue_count_; }
+  /// Average time from sending a command to receiving its response, in ms.
+  float get_average_round_trip() const { return this->average_round_trip_; }
 
  protected:
-  std::deque<NextionQueue *> nextion_queue_;
-  std::deque<NextionQueue *> waveform_queue_;
+  /// Ring of the queued commands, oldest first. The first `queue_sent_` entries have been handed to the Nextion.
+  std::vector<NextionQueue> nextion_queue_;
+  size_t queue_head_{0};
+  size_t queue_count_{0};
+  size_t queue_sent_{0};
+  /// Number of commands written to the Nextion that haven't been answered yet.
+  size_t queue_in_flight_{0};
+  size_t max_queue_size_{64};
+  /// Text of the queued commands, written in queue order and wrapping around.
+  std::vector<char> command_buffer_;
+  size_t command_buffer_write_{0};
+  std::deque<NextionComponentBase *> waveform_queue_;
+
+  NextionQueue &queue_at_(size_t index) {
+    return this->nextion_queue_[(this->queue_head_ + index) % this->nextion_queue_.size()];
+  }
+  void pop_queue_front_();
+  /// Write the queued commands to the Nextion while it has fewer than MAX_COMMANDS_IN_FLIGHT to answer.
+  void send_queued_commands_();
+  void log_stats_();
+
+  uint32_t queue_max_depth_{0};
+  uint32_t commands_answered_{0};
+  uint32_t commands_dropped_{0};
+  uint32_t commands_coalesced_{0};
+  float average_round_trip_{0.0f};
+
   uint16_t recv_ret_string_(std::string &response, uint32_t timeout, bool recv_flag);
   void all_components_send_state_(bool force_update = false);
   uint64_t comok_sent_ = 0;
@@ -799,21 +832,38 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
    * @param command The command to write, for example "vis b0,0".
    */
   bool send_command_(const std::string &command);
-  void add_no_result_to_queue_(const std::string &variable_name);
-  bool add_no_result_to_queue_with_ignore_sleep_printf_(const std::string &variable_name, const char *format, ...)
+  /**
+   * Format a command into the command buffer and queue it for sending.
+   *
+   * The command is dropped if the queue is full.
+   * @param variable_name Name for the log; "sleep_wake" marks the command that wakes the Nextion up.
+   * @param component The component waiting for the returned value, nullptr if the command only returns a result code.
+   * @param coalesce Whether the command is a component's assignment, which supersedes an earlier assignment to the
+   * same variable that hasn't been sent yet.
+   */
+  bool queue_vprintf_(const char *variable_name, NextionComponentBase *component, bool coalesce, const char *format,
+                      va_list arg);
+  bool queue_printf_(const char *variable_name, NextionComponentBase *component, bool coalesce, const char *format,
+                     ...) __attribute__((format(printf, 5, 6)));
+  /// Skip the commands that haven't been sent yet, except for waking the Nextion up.
+  void drop_unsent_commands_();
+  bool add_no_result_to_queue_with_ignore_sleep_printf_(const char *variable_name, const char *format, ...)
+      __attribute__((format(printf, 3, 4)));
+
+  bool add_no_result_to_queue_with_printf_(const char *variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
-  void add_no_result_to_queue_with_command_(const std::string &variable_name, const std::string &command);
 
-  bool add_no_result_to_queue_with_printf_(const std::string &variable_name, const char *format, ...)
+  /// Like add_no_result_to_queue_with_printf_(), for a component's assignment that may supersede a queued one.
+  bool add_no_result_to_queue_with_set_printf_(const char *variable_name, const char *format, ...)
       __attribute__((format(printf, 3, 4)));
 
-  void add_no_result_to_queue_with_set_internal_(const std::string &variable_name,
-                                                 const std::string &variable_name_to_send, int state_value,
-                                                 bool is_sleep_safe = false);
+  void add_no_result_to_queue_with_set_internal_(const char *variable_name, const char *variable_name_to_send,
+                                                 int state_value, bool is_sleep_safe = false,
+                                                 bool coalesce = false);
 
-  void add_no_result_to_queue_with_set_internal_(const std::string &variable_name,
-                                                 const std::string &variable_name_to_send,
-                                                 const std::string &state_value, bool is_sleep_safe = false);
+  void add_no_result_to_queue_with_set_internal_(const char *variable_name, const char *variable_name_to_send,
+                                                 const std::string &state_value, bool is_sleep_safe = false,
+                                                 bool coalesce = false);
 
   void check_pending_waveform_();
 
@@ -908,7 +958,9 @@ class Nextion : public NextionBase, public PollingComponent, public uart::UARTDe
 #endif
   void reset_(bool reset_nextion = true);
 
-  std::string command_data_;
+  /// Data received from the Nextion that hasn't been handled yet.
+  std::vector<uint8_t> rx_buffer_;
+  size_t rx_length_{0};
   bool is_connected_ = false;
   uint32_t startup_override_ms_ = 8000;
   uint32_t max_q_age_ms_ = 8000;
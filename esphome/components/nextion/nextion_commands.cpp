@@ -27,6 +27,7 @@ void Nextion::set_touch_sleep_timeout(uint16_t timeout) {
 void Nextion::sleep(bool sleep) {
   if (sleep) {  // Set sleep
     this->is_sleeping_ = true;
+    this->drop_unsent_commands_();
     this->add_no_result_to_queue_with_set_internal_("sleep", "sleep", 1, true);
   } else {  // Turn off sleep. Wait for a sleep_wake return before setting sleep off
     this->add_no_result_to_queue_with_set_internal_("sleep_wake", "sleep", 0, true);
@@ -55,64 +56,67 @@ void Nextion::set_protocol_reparse_mode(bool active_mode) {
 
 // Set Colors
 void Nextion::set_component_background_color(const char *component, uint32_t color) {
-  this->add_no_result_to_queue_with_printf_("set_component_background_color", "%s.bco=%" PRIu32, component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_background_color", "%s.bco=%" PRIu32, component,
+                                                color);
 }
 
 void Nextion::set_component_background_color(const char *component, const char *color) {
-  this->add_no_result_to_queue_with_printf_("set_component_background_color", "%s.bco=%s", component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_background_color", "%s.bco=%s", component, color);
 }
 
 void Nextion::set_component_background_color(const char *component, Color color) {
-  this->add_no_result_to_queue_with_printf_("set_component_background_color", "%s.bco=%d", component,
-                                            display::ColorUtil::color_to_565(color));
+  this->add_no_result_to_queue_with_set_printf_("set_component_background_color", "%s.bco=%d", component,
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::set_component_pressed_background_color(const char *component, uint32_t color) {
-  this->add_no_result_to_queue_with_printf_("set_component_pressed_background_color", "%s.bco2=%" PRIu32, component,
-                                            color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_pressed_background_color", "%s.bco2=%" PRIu32,
+                                                component, color);
 }
 
 void Nextion::set_component_pressed_background_color(const char *component, const char *color) {
-  this->add_no_result_to_queue_with_printf_("set_component_pressed_background_color", "%s.bco2=%s", component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_pressed_background_color", "%s.bco2=%s", component,
+                                                color);
 }
 
 void Nextion::set_component_pressed_background_color(const char *component, Color color) {
-  this->add_no_result_to_queue_with_printf_("set_component_pressed_background_color", "%s.bco2=%d", component,
-                                            display::ColorUtil::color_to_565(color));
+  this->add_no_result_to_queue_with_set_printf_("set_component_pressed_background_color", "%s.bco2=%d", component,
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::set_component_pic(const char *component, uint8_t pic_id) {
-  this->add_no_result_to_queue_with_printf_("set_component_pic", "%s.pic=%d", component, pic_id);
+  this->add_no_result_to_queue_with_set_printf_("set_component_pic", "%s.pic=%d", component, pic_id);
 }
 
 void Nextion::set_component_picc(const char *component, uint8_t pic_id) {
-  this->add_no_result_to_queue_with_printf_("set_component_pic", "%s.picc=%d", component, pic_id);
+  this->add_no_result_to_queue_with_set_printf_("set_component_pic", "%s.picc=%d", component, pic_id);
 }
 
 void Nextion::set_component_font_color(const char *component, uint32_t color) {
-  this->add_no_result_to_queue_with_printf_("set_component_font_color", "%s.pco=%" PRIu32, component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_font_color", "%s.pco=%" PRIu32, component, color);
 }
 
 void Nextion::set_component_font_color(const char *component, const char *color) {
-  this->add_no_result_to_queue_with_printf_("set_component_font_color", "%s.pco=%s", component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_font_color", "%s.pco=%s", component, color);
 }
 
 void Nextion::set_component_font_color(const char *component, Color color) {
-  this->add_no_result_to_queue_with_printf_("set_component_font_color", "%s.pco=%d", component,
-                                            display::ColorUtil::color_to_565(color));
+  this->add_no_result_to_queue_with_set_printf_("set_component_font_color", "%s.pco=%d", component,
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::set_component_pressed_font_color(const char *component, uint32_t color) {
-  this->add_no_result_to_queue_with_printf_("set_component_pressed_font_color", "%s.pco2=%" PRIu32, component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_pressed_font_color", "%s.pco2=%" PRIu32, component,
+                                                color);
 }
 
 void Nextion::set_component_pressed_font_color(const char *component, const char *color) {
-  this->add_no_result_to_queue_with_printf_("set_component_pressed_font_color", " %s.pco2=%s", component, color);
+  this->add_no_result_to_queue_with_set_printf_("set_component_pressed_font_color", " %s.pco2=%s", component, color);
 }
 
 void Nextion::set_component_pressed_font_color(const char *component, Color color) {
-  this->add_no_result_to_queue_with_printf_("set_component_pressed_font_color", "%s.pco2=%d", component,
-                                            display::ColorUtil::color_to_565(color));
+  this->add_no_result_to_queue_with_set_printf_("set_component_pressed_font_color", "%s.pco2=%d", component,
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::set_component_text_printf(const char *component, const char *format, ...) {
@@ -143,7 +147,7 @@ void Nextion::set_auto_wake_on_touch(bool auto_wake) {
 
 // General Component
 void Nextion::set_component_font(const char *component, uint8_t font_id) {
-  this->add_no_result_to_queue_with_printf_("set_component_font", "%s.font=%d", component, font_id);
+  this->add_no_result_to_queue_with_set_printf_("set_component_font", "%s.font=%d", component, font_id);
 }
 
 void Nextion::hide_component(const char *component) {
@@ -163,15 +167,15 @@ void Nextion::disable_component_touch(const char *component) {
 }
 
 void Nextion::set_component_picture(const char *component, const char *picture) {
-  this->add_no_result_to_queue_with_printf_("set_component_picture", "%s.val=%s", component, picture);
+  this->add_no_result_to_queue_with_set_printf_("set_component_picture", "%s.val=%s", component, picture);
 }
 
 void Nextion::set_component_text(const char *component, const char *text) {
-  this->add_no_result_to_queue_with_printf_("set_component_text", "%s.txt=\"%s\"", component, text);
+  this->add_no_result_to_queue_with_set_printf_("set_component_text", "%s.txt=\"%s\"", component, text);
 }
 
 void Nextion::set_component_value(const char *component, int value) {
-  this->add_no_result_to_queue_with_printf_("set_component_value", "%s.val=%d", component, value);
+  this->add_no_result_to_queue_with_set_printf_("set_component_value", "%s.val=%d", component, value);
 }
 
 void Nextion::add_waveform_data(int component_id, uint8_t channel_number, uint8_t value) {
@@ -184,8 +188,8 @@ void Nextion::open_waveform_channel(int component_id, uint8_t channel_number, ui
 }
 
 void Nextion::set_component_coordinates(const char *component, int x, int y) {
-  this->add_no_result_to_queue_with_printf_("set_component_coordinates command 1", "%s.xcen=%d", component, x);
-  this->add_no_result_to_queue_with_printf_("set_component_coordinates command 2", "%s.ycen=%d", component, y);
+  this->add_no_result_to_queue_with_set_printf_("set_component_coordinates command 1", "%s.xcen=%d", component, x);
+  this->add_no_result_to_queue_with_set_printf_("set_component_coordinates command 2", "%s.ycen=%d", component, y);
 }
 
 // Drawing
@@ -199,7 +203,7 @@ void Nextion::fill_area(int x1, int y1, int width, int height, const char *color
 
 void Nextion::fill_area(int x1, int y1, int width, int height, Color color) {
   this->add_no_result_to_queue_with_printf_("fill_area", "fill %d,%d,%d,%d,%d", x1, y1, width, height,
-                                            display::ColorUtil::color_to_565(color));
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::line(int x1, int y1, int x2, int y2, const char *color) {
@@ -208,7 +212,7 @@ void Nextion::line(int x1, int y1, int x2, int y2, const char *color) {
 
 void Nextion::line(int x1, int y1, int x2, int y2, Color color) {
   this->add_no_result_to_queue_with_printf_("line", "line %d,%d,%d,%d,%d", x1, y1, x2, y2,
-                                            display::ColorUtil::color_to_565(color));
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::rectangle(int x1, int y1, int width, int height, const char *color) {
@@ -217,7 +221,7 @@ void Nextion::rectangle(int x1, int y1, int width, int height, const char *color
 
 void Nextion::rectangle(int x1, int y1, int width, int height, Color color) {
   this->add_no_result_to_queue_with_printf_("draw", "draw %d,%d,%d,%d,%d", x1, y1, x1 + width, y1 + height,
-                                            display::ColorUtil::color_to_565(color));
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::circle(int center_x, int center_y, int radius, const char *color) {
@@ -226,7 +230,7 @@ void Nextion::circle(int center_x, int center_y, int radius, const char *color)
 
 void Nextion::circle(int center_x, int center_y, int radius, Color color) {
   this->add_no_result_to_queue_with_printf_("cir", "cir %d,%d,%d,%d", center_x, center_y, radius,
-                                            display::ColorUtil::color_to_565(color));
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::filled_circle(int center_x, int center_y, int radius, const char *color) {
@@ -235,7 +239,7 @@ void Nextion::filled_circle(int center_x, int center_y, int radius, const char *
 
 void Nextion::filled_circle(int center_x, int center_y, int radius, Color color) {
   this->add_no_result_to_queue_with_printf_("cirs", "cirs %d,%d,%d,%d", center_x, center_y, radius,
-                                            display::ColorUtil::color_to_565(color));
+                                                display::ColorUtil::color_to_565(color));
 }
 
 void Nextion::set_nextion_rtc_time(ESPTime time) {
@@ -20,11 +20,24 @@ static const char *const NEXTION_QUEUE_TYPE_STRINGS[] = {"NO_RESULT", "SENSOR",
 
 class NextionComponentBase;
 
+/// A command in the command queue, waiting to be sent or for its response.
 class NextionQueue {
  public:
-  virtual ~NextionQueue() = default;
-  NextionComponentBase *component;
+  /// The component waiting for the returned value, nullptr if the command only returns a result code.
+  NextionComponentBase *component{nullptr};
+  /// When the command was queued, or sent once it has been.
   uint32_t queue_time = 0;
+  /// Position and length of the command text in the command buffer.
+  uint16_t command_start = 0;
+  uint16_t command_length = 0;
+  /// Length of the variable the command assigns to, like "t0.txt" in "t0.txt=\"abc\"", or 0.
+  uint8_t assign_length = 0;
+  /// Written to the Nextion and waiting for its response.
+  bool sent = false;
+  /// Replaced by a later assignment to the same variable before it was sent; it is never sent.
+  bool superseded = false;
+  /// Wakes the Nextion up, which is awake once the command has been answered.
+  bool sleep_wake = false;
 };
 
 class NextionComponentBase {
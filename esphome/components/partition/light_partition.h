@@ -56,6 +56,7 @@ class PartitionLightOutput : public light::AddressableLight {
       seg.get_src()->schedule_show();
     }
     this->mark_shown_();
+    this->record_frame_shown_();
   }
 
  protected:
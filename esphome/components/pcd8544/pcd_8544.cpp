@@ -1,5 +1,6 @@
 #include "pcd_8544.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 
@@ -113,7 +114,9 @@ void PCD8544::command(uint8_t value) {
 
 void PCD8544::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 
 void PCD8544::fill(Color color) {
@@ -13,10 +13,9 @@ void Pipsolar::setup() {
 }
 
 void Pipsolar::empty_uart_buffer_() {
-  uint8_t byte;
-  while (this->available()) {
-    this->read_byte(&byte);
-  }
+  const uint8_t *data;
+  while (size_t len = this->peek_span(&data))
+    this->consume(len);
 }
 
 void Pipsolar::loop() {
@@ -713,29 +712,19 @@ void Pipsolar::loop() {
   }
 
   if (this->state_ == STATE_COMMAND || this->state_ == STATE_POLL) {
-    while (this->available()) {
-      uint8_t byte;
-      this->read_byte(&byte);
-
-      if (this->read_pos_ == PIPSOLAR_READ_BUFFER_LENGTH) {
-        this->read_pos_ = 0;
-        this->empty_uart_buffer_();
+    // An answer ends with CR; one byte is kept free for the terminating zero
+    const size_t len = this->read_until(0x0D, this->read_buffer_, PIPSOLAR_READ_BUFFER_LENGTH - 1);
+    if (len > 0) {
+      this->read_pos_ = len;
+      this->read_buffer_[this->read_pos_] = 0;
+      this->empty_uart_buffer_();
+      if (this->state_ == STATE_POLL) {
+        this->state_ = STATE_POLL_COMPLETE;
       }
-      this->read_buffer_[this->read_pos_] = byte;
-      this->read_pos_++;
-
-      // end of answer
-      if (byte == 0x0D) {
-        this->read_buffer_[this->read_pos_] = 0;
-        this->empty_uart_buffer_();
-        if (this->state_ == STATE_POLL) {
-          this->state_ = STATE_POLL_COMPLETE;
-        }
-        if (this->state_ == STATE_COMMAND) {
-          this->state_ = STATE_COMMAND_COMPLETE;
-        }
+      if (this->state_ == STATE_COMMAND) {
+        this->state_ = STATE_COMMAND_COMPLETE;
       }
-    }  // available
+    }
   }
   if (this->state_ == STATE_COMMAND) {
     if (millis() - this->command_start_millis_ > esphome::pipsolar::Pipsolar::COMMAND_TIMEOUT) {
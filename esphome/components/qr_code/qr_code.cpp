@@ -16,11 +16,13 @@ void QrCode::dump_config() {
 void QrCode::set_value(const std::string &value) {
   this->value_ = value;
   this->needs_update_ = true;
+  this->change_callback_.call();
 }
 
 void QrCode::set_ecc(qrcodegen_Ecc ecc) {
   this->ecc_ = ecc;
   this->needs_update_ = true;
+  this->change_callback_.call();
 }
 
 void QrCode::generate_qr_code() {
@@ -1,6 +1,7 @@
 #pragma once
 #include "esphome/core/component.h"
 #include "esphome/core/color.h"
+#include "esphome/core/helpers.h"
 
 #include <cstdint>
 
@@ -21,6 +22,8 @@ class QrCode : public Component {
 
   void set_value(const std::string &value);
   void set_ecc(qrcodegen_Ecc ecc);
+  /// Called whenever the value or error correction level changes, so the code is drawn again.
+  void add_on_change_callback(std::function<void()> &&callback) { this->change_callback_.add(std::move(callback)); }
 
   void generate_qr_code();
 
@@ -29,6 +32,7 @@ class QrCode : public Component {
   qrcodegen_Ecc ecc_;
   bool needs_update_ = true;
   uint8_t qr_[qrcodegen_BUFFER_LEN_MAX];
+  CallbackManager<void()> change_callback_;
 };
 }  // namespace qr_code
 }  // namespace esphome
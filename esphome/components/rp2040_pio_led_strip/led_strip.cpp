@@ -1,11 +1,14 @@
 #include "led_strip.h"
 
+#include <cinttypes>
+
 #ifdef USE_RP2040
 
 #include "esphome/core/helpers.h"
 #include "esphome/core/log.h"
 
 #include <hardware/clocks.h>
+#include <hardware/dma.h>
 #include <hardware/pio.h>
 #include <pico/stdlib.h>
 
@@ -34,6 +37,14 @@ void RP2040PIOLEDStripLightOutput::setup() {
     return;
   }
 
+  ExternalRAMAllocator<uint32_t> word_allocator(ExternalRAMAllocator<uint32_t>::ALLOW_FAILURE);
+  this->words_ = word_allocator.allocate(this->num_leds_);
+  if (this->words_ == nullptr) {
+    ESP_LOGE(TAG, "Failed to allocate PIO buffer of size %u", this->num_leds_ * 4);
+    this->mark_failed();
+    return;
+  }
+
   // Select PIO instance to use (0 or 1)
   this->pio_ = pio0;
   if (this->pio_ == nullptr) {
@@ -53,6 +64,20 @@ void RP2040PIOLEDStripLightOutput::setup() {
     return;
   }
   this->init_(this->pio_, this->sm_, offset, this->pin_, this->max_refresh_rate_);
+
+  // Feed the state machine from the word buffer by DMA, so sending a frame doesn't block the main loop
+  this->dma_channel_ = dma_claim_unused_channel(false);
+  if (this->dma_channel_ < 0) {
+    ESP_LOGE(TAG, "Failed to claim DMA channel");
+    this->mark_failed();
+    return;
+  }
+  dma_channel_config config = dma_channel_get_default_config(this->dma_channel_);
+  channel_config_set_transfer_data_size(&config, DMA_SIZE_32);
+  channel_config_set_read_increment(&config, true);
+  channel_config_set_write_increment(&config, false);
+  channel_config_set_dreq(&config, pio_get_dreq(this->pio_, this->sm_, true));
+  dma_channel_configure(this->dma_channel_, &config, &this->pio_->txf[this->sm_], this->words_, this->num_leds_, false);
 }
 
 void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
@@ -68,19 +93,52 @@ void RP2040PIOLEDStripLightOutput::write_state(light::LightState *state) {
     return;
   }
 
-  // assemble bits in buffer to 32 bit words with ex for GBR: 0bGGGGGGGGRRRRRRRRBBBBBBBB00000000
-  for (int i = 0; i < this->num_leds_; i++) {
-    uint8_t c1 = this->buf_[(i * 3) + 0];
-    uint8_t c2 = this->buf_[(i * 3) + 1];
-    uint8_t c3 = this->buf_[(i * 3) + 2];
-    uint8_t w = this->is_rgbw_ ? this->buf_[(i * 4) + 3] : 0;
-    uint32_t color = encode_uint32(c1, c2, c3, w);
-    pio_sm_put_blocking(this->pio_, this->sm_, color);
+  if (this->frame_group_ != nullptr) {
+    this->request_group_frame_();
+    return;
+  }
+
+  // protect from refreshing too often
+  uint32_t now = micros();
+  if (this->max_refresh_rate_ != 0 && (now - this->last_refresh_) < this->max_refresh_rate_) {
+    // try again next loop iteration, so that this change won't get lost
+    this->schedule_show();
+    return;
+  }
+
+  // The word buffer is still being sent; the newest data goes out next time
+  if (this->is_sending_()) {
+    this->record_frame_deferred_();
+    return;
+  }
+
+  this->send_frame_();
+}
+
+bool RP2040PIOLEDStripLightOutput::is_sending_() {
+  return dma_channel_is_busy(this->dma_channel_) || !pio_sm_is_tx_fifo_empty(this->pio_, this->sm_);
+}
+
+uint32_t RP2040PIOLEDStripLightOutput::get_frame_checksum_() {
+  return frame_checksum_(this->buf_, this->get_buffer_size_());
+}
+
+void RP2040PIOLEDStripLightOutput::send_frame_() {
+  uint32_t checksum = this->get_frame_checksum_();
+  if (this->is_frame_unchanged_(checksum)) {
+    ESP_LOGVV(TAG, "LED values unchanged, skipping frame");
+    this->record_frame_skipped_();
+    return;
   }
+
+  this->last_refresh_ = micros();
+  // assemble bits in buffer to 32 bit words with ex for GBR: 0bGGGGGGGGRRRRRRRRBBBBBBBB00000000
+  light::encode_pio_words(this->buf_, this->num_leds_, this->is_rgbw_, this->words_);
+  dma_channel_transfer_from_buffer_now(this->dma_channel_, this->words_, this->num_leds_);
+  this->record_frame_shown_(checksum);
 }
 
-light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t index) const {
-  int32_t r = 0, g = 0, b = 0, w = 0;
+void RP2040PIOLEDStripLightOutput::get_rgb_offsets_(int32_t &r, int32_t &g, int32_t &b) const {
   switch (this->rgb_order_) {
     case ORDER_RGB:
       r = 0;
@@ -113,6 +171,11 @@ light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t inde
       b = 0;
       break;
   }
+}
+
+light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t index) const {
+  int32_t r = 0, g = 0, b = 0, w = 0;
+  this->get_rgb_offsets_(r, g, b);
   uint8_t multiplier = this->is_rgbw_ ? 4 : 3;
   return {this->buf_ + (index * multiplier) + r,
           this->buf_ + (index * multiplier) + g,
@@ -122,13 +185,21 @@ light::ESPColorView RP2040PIOLEDStripLightOutput::get_view_internal(int32_t inde
           &this->correction_};
 }
 
+light::ESPColorSpan RP2040PIOLEDStripLightOutput::get_span_internal() const {
+  int32_t r = 0, g = 0, b = 0;
+  this->get_rgb_offsets_(r, g, b);
+  if (this->is_rgbw_)
+    return {this->buf_, this->size(), 4, (uint8_t) r, (uint8_t) g, (uint8_t) b, 3};
+  return {this->buf_, this->size(), 3, (uint8_t) r, (uint8_t) g, (uint8_t) b};
+}
+
 void RP2040PIOLEDStripLightOutput::dump_config() {
   ESP_LOGCONFIG(TAG, "RP2040 PIO LED Strip Light Output:");
   ESP_LOGCONFIG(TAG, "  Pin: GPIO%d", this->pin_);
   ESP_LOGCONFIG(TAG, "  Number of LEDs: %d", this->num_leds_);
   ESP_LOGCONFIG(TAG, "  RGBW: %s", YESNO(this->is_rgbw_));
   ESP_LOGCONFIG(TAG, "  RGB Order: %s", rgb_order_to_string(this->rgb_order_));
-  ESP_LOGCONFIG(TAG, "  Max Refresh Rate: %f Hz", this->max_refresh_rate_);
+  ESP_LOGCONFIG(TAG, "  Max refresh rate: %" PRIu32 " us", this->max_refresh_rate_);
 }
 
 float RP2040PIOLEDStripLightOutput::get_setup_priority() const { return setup_priority::HARDWARE; }
@@ -7,6 +7,7 @@
 #include "esphome/core/helpers.h"
 
 #include "esphome/components/light/addressable_light.h"
+#include "esphome/components/light/led_encoding.h"
 #include "esphome/components/light/light_output.h"
 
 #include <hardware/pio.h>
@@ -63,7 +64,8 @@ class RP2040PIOLEDStripLightOutput : public light::AddressableLight {
   void set_num_leds(uint32_t num_leds) { this->num_leds_ = num_leds; }
   void set_is_rgbw(bool is_rgbw) { this->is_rgbw_ = is_rgbw; }
 
-  void set_max_refresh_rate(float interval_us) { this->max_refresh_rate_ = interval_us; }
+  /// Set a maximum refresh rate in µs as some lights do not like being updated too often.
+  void set_max_refresh_rate(uint32_t interval_us) { this->max_refresh_rate_ = interval_us; }
 
   void set_pio(int pio_num) { pio_num ? this->pio_ = pio1 : this->pio_ = pio0; }
   void set_program(const pio_program_t *program) { this->program_ = program; }
@@ -80,11 +82,17 @@ class RP2040PIOLEDStripLightOutput : public light::AddressableLight {
 
  protected:
   light::ESPColorView get_view_internal(int32_t index) const override;
+  light::ESPColorSpan get_span_internal() const override;
+  bool is_sending_() override;
+  void send_frame_() override;
+  uint32_t get_frame_checksum_() override;
+  void get_rgb_offsets_(int32_t &r, int32_t &g, int32_t &b) const;
 
   size_t get_buffer_size_() const { return this->num_leds_ * (3 + this->is_rgbw_); }
 
   uint8_t *buf_{nullptr};
   uint8_t *effect_data_{nullptr};
+  uint32_t *words_{nullptr};
 
   uint8_t pin_;
   uint32_t num_leds_;
@@ -92,11 +100,12 @@ class RP2040PIOLEDStripLightOutput : public light::AddressableLight {
 
   pio_hw_t *pio_;
   uint sm_;
+  int dma_channel_{-1};
 
   RGBOrder rgb_order_{ORDER_RGB};
 
   uint32_t last_refresh_{0};
-  float max_refresh_rate_;
+  uint32_t max_refresh_rate_{0};
 
   const pio_program_t *program_;
   init_fn init_;
@@ -5,6 +5,7 @@ from esphome.components import light, rp2040
 from esphome.const import (
     CONF_CHIPSET,
     CONF_ID,
+    CONF_MAX_REFRESH_RATE,
     CONF_NUM_LEDS,
     CONF_OUTPUT_ID,
     CONF_PIN,
@@ -194,6 +195,8 @@ CONFIG_SCHEMA = cv.All(
             cv.Required(CONF_PIO): cv.one_of(0, 1, int=True),
             cv.Optional(CONF_CHIPSET): cv.one_of(*CHIPSETS, upper=True),
             cv.Optional(CONF_IS_RGBW, default=False): cv.boolean,
+            cv.Optional(CONF_MAX_REFRESH_RATE): cv.positive_time_period_microseconds,
+            cv.Optional(light.CONF_FRAME_GROUP): cv.validate_id_name,
             cv.Inclusive(
                 CONF_BIT0_HIGH,
                 "custom",
@@ -227,6 +230,12 @@ async def to_code(config):
 
     cg.add(var.set_rgb_order(config[CONF_RGB_ORDER]))
     cg.add(var.set_is_rgbw(config[CONF_IS_RGBW]))
+    if CONF_MAX_REFRESH_RATE in config:
+        cg.add(var.set_max_refresh_rate(config[CONF_MAX_REFRESH_RATE]))
+    if light.CONF_FRAME_GROUP in config:
+        light.add_to_frame_group(
+            var, config[light.CONF_FRAME_GROUP], config.get(CONF_MAX_REFRESH_RATE)
+        )
 
     cg.add(var.set_pio(config[CONF_PIO]))
     cg.add(var.set_program(cg.RawExpression(f"&rp2040_pio_led_strip_{id}_program")))
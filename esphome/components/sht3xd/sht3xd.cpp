@@ -51,7 +51,7 @@ void SHT3XDComponent::update() {
     return;
   }
 
-  this->set_timeout(50, [this]() {
+  this->schedule_transaction(50, [this]() {
     uint16_t raw_data[2];
     if (!this->read_data(raw_data, 2)) {
       this->status_set_warning();
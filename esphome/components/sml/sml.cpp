@@ -3,6 +3,8 @@
 #include "esphome/core/helpers.h"
 #include "sml_parser.h"
 
+#include <cinttypes>
+
 namespace esphome {
 namespace sml {
 
@@ -25,77 +27,85 @@ char Sml::check_start_end_bytes_(uint8_t byte) {
 }
 
 void Sml::loop() {
-  while (available()) {
-    const char c = read();
-
-    if (this->record_)
-      this->sml_data_.emplace_back(c);
-
-    switch (this->check_start_end_bytes_(c)) {
-      case START_BYTES_DETECTED: {
-        this->record_ = true;
-        this->sml_data_.clear();
-        // add start sequence (for callbacks)
-        this->sml_data_.insert(this->sml_data_.begin(), START_SEQ.begin(), START_SEQ.end());
-        break;
-      };
-      case END_BYTES_DETECTED: {
-        if (this->record_) {
-          this->record_ = false;
-
-          bool valid = check_sml_data(this->sml_data_);
-
-          // call callbacks
-          this->data_callbacks_.call(this->sml_data_, valid);
-
-          if (!valid)
-            break;
-
-          // remove start/end sequence
-          this->sml_data_.erase(this->sml_data_.begin(), this->sml_data_.begin() + START_SEQ.size());
-          this->sml_data_.resize(this->sml_data_.size() - 8);
-          this->process_sml_file_(this->sml_data_);
-        }
-        break;
-      };
-    };
+  const uint8_t *data;
+  while (size_t len = this->peek_span(&data)) {
+    for (size_t i = 0; i < len; i++)
+      this->handle_byte_(data[i]);
+    this->consume(len);
   }
 }
 
-void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
-  this->data_callbacks_.add(std::move(callback));
-}
+void Sml::handle_byte_(const char c) {
+  if (this->record_)
+    this->sml_data_.push_back(c);
 
-void Sml::process_sml_file_(const bytes &sml_data) {
-  SmlFile sml_file = SmlFile(sml_data);
-  std::vector<ObisInfo> obis_info = sml_file.get_obis_info();
-  this->publish_obis_info_(obis_info);
+  switch (this->check_start_end_bytes_(c)) {
+    case START_BYTES_DETECTED: {
+      this->record_ = true;
+      // add start sequence (for callbacks)
+      this->sml_data_.assign(START_SEQ.begin(), START_SEQ.end());
+      break;
+    };
+    case END_BYTES_DETECTED: {
+      if (this->record_) {
+        this->record_ = false;
+
+        bool valid = check_sml_data(this->sml_data_);
+
+        // call callbacks
+        this->data_callbacks_.call(this->sml_data_, valid);
+
+        if (!valid)
+          break;
 
-  this->log_obis_info_(obis_info);
+        // skip start/end sequence
+        this->process_sml_file_(BytesView(this->sml_data_.data() + START_SEQ.size(),
+                                          this->sml_data_.size() - START_SEQ.size() - 8));
+      }
+      break;
+    };
+  };
 }
 
-void Sml::log_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
-  ESP_LOGD(TAG, "OBIS info:");
-  for (auto const &obis_info : obis_info_vec) {
-    std::string info;
-    info += "  (" + bytes_repr(obis_info.server_id) + ") ";
-    info += obis_info.code_repr();
-    info += " [0x" + bytes_repr(obis_info.value) + "]";
-    ESP_LOGD(TAG, "%s", info.c_str());
-  }
+void Sml::add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback) {
+  this->data_callbacks_.add(std::move(callback));
 }
 
-void Sml::publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec) {
-  for (auto const &obis_info : obis_info_vec) {
+void Sml::process_sml_file_(const BytesView &sml_data) {
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  const uint32_t start = micros();
+#endif
+  ESP_LOGD(TAG, "OBIS info:");
+  SmlFile sml_file = SmlFile(sml_data);
+  ObisInfo obis_info;
+  while (sml_file.next_obis_info(&obis_info)) {
     this->publish_value_(obis_info);
+    this->log_obis_info_(obis_info);
   }
+#ifdef ESPHOME_LOG_HAS_VERBOSE
+  ESP_LOGV(TAG, "Handled %zu bytes in %" PRIu32 " us", sml_data.size(), micros() - start);
+#endif
+}
+
+void Sml::log_obis_info_(const ObisInfo &obis_info) {
+#ifdef ESPHOME_LOG_HAS_DEBUG
+  char code[20];
+  char server_id[33];
+  char value[65];
+  obis_info.code_repr(code, sizeof(code));
+  bytes_repr(obis_info.server_id, server_id, sizeof(server_id));
+  bytes_repr(obis_info.value, value, sizeof(value));
+  ESP_LOGD(TAG, "  (%s) %s [0x%s]", server_id, code, value);
+#endif
 }
 
 void Sml::publish_value_(const ObisInfo &obis_info) {
+  char code[20];
+  obis_info.code_repr(code, sizeof(code));
   for (auto const &sml_listener : sml_listeners_) {
-    if ((!sml_listener->server_id.empty()) && (bytes_repr(obis_info.server_id) != sml_listener->server_id))
+    if ((!sml_listener->server_id.empty()) && !bytes_repr_equals(obis_info.server_id, sml_listener->server_id))
       continue;
-    if (obis_info.code_repr() != sml_listener->obis_code)
+    if (sml_listener->obis_code != code)
       continue;
     sml_listener->publish_val(obis_info);
   }
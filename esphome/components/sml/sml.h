@@ -27,15 +27,16 @@ class Sml : public Component, public uart::UARTDevice {
   void add_on_data_callback(std::function<void(std::vector<uint8_t>, bool)> &&callback);
 
  protected:
-  void process_sml_file_(const bytes &sml_data);
-  void log_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
-  void publish_obis_info_(const std::vector<ObisInfo> &obis_info_vec);
+  void process_sml_file_(const BytesView &sml_data);
+  void log_obis_info_(const ObisInfo &obis_info);
   char check_start_end_bytes_(uint8_t byte);
+  void handle_byte_(char c);
   void publish_value_(const ObisInfo &obis_info);
 
   // Serial parser
   bool record_ = false;
   uint16_t incoming_mask_ = 0;
+  /// Telegram being received, including the start and end sequences. Keeps its capacity between telegrams.
   bytes sml_data_;
 
   CallbackManager<void(const std::vector<uint8_t> &, bool)> data_callbacks_{};
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "esphome/core/helpers.h"
 #include "constants.h"
 #include "sml_parser.h"
@@ -5,27 +6,47 @@
 namespace esphome {
 namespace sml {
 
-SmlFile::SmlFile(bytes buffer) : buffer_(std::move(buffer)) {
-  // extract messages
-  this->pos_ = 0;
-  while (this->pos_ < this->buffer_.size()) {
-    if (this->buffer_[this->pos_] == 0x00)
-      break;  // fill byte detected -> no more messages
-
-    SmlNode message = SmlNode();
-    if (!this->setup_node(&message))
-      break;
-    this->messages.emplace_back(message);
+SmlFile::SmlFile(BytesView buffer) : buffer_(buffer) {}
+
+bool SmlFile::next_obis_info(ObisInfo *obis_info) {
+  while (true) {
+    bool ok;
+    if (this->entries_left_ > 0) {
+      this->entries_left_--;
+      ok = this->read_val_list_entry_(obis_info);
+      // OBIS codes have six bytes, the last one is usually 0xff
+      if (ok && obis_info->code.size() >= 5) {
+        obis_info->server_id = this->server_id_;
+        return true;
+      }
+    } else if (this->trailing_nodes_ > 0) {
+      ok = this->skip_nodes_(this->trailing_nodes_);
+      this->trailing_nodes_ = 0;
+    } else {
+      ok = this->next_val_list_();
+    }
+    if (!ok) {
+      // malformed or no more messages -> stop reading
+      this->pos_ = this->buffer_.size();
+      this->entries_left_ = 0;
+      this->trailing_nodes_ = 0;
+      return false;
+    }
   }
 }
 
-bool SmlFile::setup_node(SmlNode *node) {
+bool SmlFile::read_node_(SmlNode *node) {
+  if (this->pos_ >= this->buffer_.size())
+    return false;
+
   uint8_t type = this->buffer_[this->pos_] >> 4;      // type including overlength info
   uint8_t length = this->buffer_[this->pos_] & 0x0f;  // length including TL bytes
   bool is_list = (type & 0x07) == SML_LIST;
   bool has_extended_length = type & 0x08;  // we have a long list/value (>15 entries)
   uint8_t parse_length = length;
   if (has_extended_length) {
+    if (this->pos_ + 1 >= this->buffer_.size())
+      return false;
     length = (length << 4) + (this->buffer_[this->pos_ + 1] & 0x0f);
     parse_length = length - 1;
     this->pos_ += 1;
@@ -35,55 +56,114 @@ bool SmlFile::setup_node(SmlNode *node) {
     return false;
 
   node->type = type & 0x07;
-  node->nodes.clear();
-  node->value_bytes.clear();
+  node->entries = 0;
+  node->value_bytes = BytesView();
   if (this->buffer_[this->pos_] == 0x00) {  // end of message
     this->pos_ += 1;
   } else if (is_list) {  // list
     this->pos_ += 1;
-    node->nodes.reserve(parse_length);
-    for (size_t i = 0; i != parse_length; i++) {
-      SmlNode child_node = SmlNode();
-      if (!this->setup_node(&child_node))
-        return false;
-      node->nodes.emplace_back(child_node);
-    }
+    node->entries = parse_length;
   } else {  // value
-    node->value_bytes =
-        bytes(this->buffer_.begin() + this->pos_ + 1, this->buffer_.begin() + this->pos_ + parse_length);
+    if (parse_length == 0)
+      return false;
+    node->value_bytes = BytesView(this->buffer_.data() + this->pos_ + 1, parse_length - 1);
     this->pos_ += parse_length;
   }
   return true;
 }
 
-std::vector<ObisInfo> SmlFile::get_obis_info() {
-  std::vector<ObisInfo> obis_info;
-  for (auto const &message : messages) {
-    SmlNode message_body = message.nodes[3];
-    uint16_t message_type = bytes_to_uint(message_body.nodes[0].value_bytes);
-    if (message_type != SML_GET_LIST_RES)
-      continue;
+bool SmlFile::skip_node_() {
+  SmlNode node;
+  return this->read_node_(&node) && this->skip_nodes_(node.entries);
+}
 
-    SmlNode get_list_response = message_body.nodes[1];
-    bytes server_id = get_list_response.nodes[1].value_bytes;
-    SmlNode val_list = get_list_response.nodes[4];
+bool SmlFile::skip_nodes_(size_t count) {
+  for (size_t i = 0; i != count; i++) {
+    if (!this->skip_node_())
+      return false;
+  }
+  return true;
+}
 
-    for (auto const &val_list_entry : val_list.nodes) {
-      obis_info.emplace_back(server_id, val_list_entry);
+bool SmlFile::next_val_list_() {
+  while (this->pos_ < this->buffer_.size()) {
+    if (this->buffer_[this->pos_] == 0x00)
+      return false;  // fill byte detected -> no more messages
+
+    // message: transactionId, groupNo, abortOnError, messageBody, crc16, endOfSmlMsg
+    SmlNode message;
+    if (!this->read_node_(&message) || message.entries < 6 || !this->skip_nodes_(3))
+      return false;
+    // messageBody: tag, content
+    SmlNode message_body, message_type;
+    if (!this->read_node_(&message_body) || message_body.entries < 2 || !this->read_node_(&message_type))
+      return false;
+    if (bytes_to_uint(message_type.value_bytes) != SML_GET_LIST_RES) {
+      if (!this->skip_nodes_(message_body.entries - 1 + message.entries - 4))
+        return false;
+      continue;
     }
+
+    // GetList.Res: clientId, serverId, listName, actSensorTime, valList, listSignature, actGatewayTime
+    SmlNode get_list_response, server_id, val_list;
+    if (!this->read_node_(&get_list_response) || get_list_response.entries < 5 || !this->skip_node_() ||
+        !this->read_node_(&server_id) || !this->skip_nodes_(server_id.entries) || !this->skip_nodes_(2) ||
+        !this->read_node_(&val_list))
+      return false;
+    this->server_id_ = server_id.value_bytes;
+    this->entries_left_ = val_list.entries;
+    this->trailing_nodes_ = (get_list_response.entries - 5) + (message_body.entries - 2) + (message.entries - 4);
+    return true;
   }
-  return obis_info;
+  return false;
 }
 
-std::string bytes_repr(const bytes &buffer) {
-  std::string repr;
-  for (auto const value : buffer) {
-    repr += str_sprintf("%02x", value & 0xff);
+bool SmlFile::read_val_list_entry_(ObisInfo *obis_info) {
+  // valListEntry: objName, status, valTime, unit, scaler, value, valueSignature
+  SmlNode entry, code, status, unit, scaler, value;
+  if (!this->read_node_(&entry) || entry.entries < 6)
+    return false;
+  if (!this->read_node_(&code) || !this->skip_nodes_(code.entries) || !this->read_node_(&status) ||
+      !this->skip_nodes_(status.entries) || !this->skip_node_() || !this->read_node_(&unit) ||
+      !this->skip_nodes_(unit.entries) || !this->read_node_(&scaler) || !this->skip_nodes_(scaler.entries) ||
+      !this->read_node_(&value) || !this->skip_nodes_(value.entries) || !this->skip_nodes_(entry.entries - 6))
+    return false;
+
+  obis_info->code = code.value_bytes;
+  obis_info->status = status.value_bytes;
+  obis_info->unit = bytes_to_uint(unit.value_bytes);
+  obis_info->scaler = bytes_to_int(scaler.value_bytes);
+  obis_info->value = value.value_bytes;
+  obis_info->value_type = value.type;
+  return true;
+}
+
+std::string bytes_repr(const BytesView &buffer) { return format_hex(buffer.data(), buffer.size()); }
+
+static char hex_char(uint8_t v) { return v >= 10 ? 'a' + (v - 10) : '0' + v; }
+
+void bytes_repr(const BytesView &buffer, char *out, size_t size) {
+  if (size == 0)
+    return;
+  size_t len = std::min(buffer.size(), (size - 1) / 2);
+  for (size_t i = 0; i < len; i++) {
+    out[i * 2] = hex_char(buffer[i] >> 4);
+    out[i * 2 + 1] = hex_char(buffer[i] & 0x0f);
   }
-  return repr;
+  out[len * 2] = '\0';
 }
 
-uint64_t bytes_to_uint(const bytes &buffer) {
+bool bytes_repr_equals(const BytesView &buffer, const std::string &hex) {
+  if (hex.size() != buffer.size() * 2)
+    return false;
+  for (size_t i = 0; i < buffer.size(); i++) {
+    if (hex[i * 2] != hex_char(buffer[i] >> 4) || hex[i * 2 + 1] != hex_char(buffer[i] & 0x0f))
+      return false;
+  }
+  return true;
+}
+
+uint64_t bytes_to_uint(const BytesView &buffer) {
   uint64_t val = 0;
   for (auto const value : buffer) {
     val = (val << 8) + value;
@@ -91,7 +171,10 @@ uint64_t bytes_to_uint(const bytes &buffer) {
   return val;
 }
 
-int64_t bytes_to_int(const bytes &buffer) {
+int64_t bytes_to_int(const BytesView &buffer) {
+  if (buffer.empty())
+    return 0;
+
   uint64_t tmp = bytes_to_uint(buffer);
   int64_t val;
 
@@ -99,7 +182,7 @@ int64_t bytes_to_int(const bytes &buffer) {
   // see https://stackoverflow.com/questions/42534749/signed-extension-from-24-bit-to-32-bit-in-c
   if (buffer.size() < 8) {
     const int bits = buffer.size() * 8;
-    const uint64_t m = 1u << (bits - 1);
+    const uint64_t m = uint64_t(1) << (bits - 1);
     tmp = (tmp ^ m) - m;
   }
 
@@ -107,20 +190,16 @@ int64_t bytes_to_int(const bytes &buffer) {
   return val;
 }
 
-std::string bytes_to_string(const bytes &buffer) { return std::string(buffer.begin(), buffer.end()); }
+std::string bytes_to_string(const BytesView &buffer) { return std::string(buffer.begin(), buffer.end()); }
 
-ObisInfo::ObisInfo(bytes server_id, SmlNode val_list_entry) : server_id(std::move(server_id)) {
-  this->code = val_list_entry.nodes[0].value_bytes;
-  this->status = val_list_entry.nodes[1].value_bytes;
-  this->unit = bytes_to_uint(val_list_entry.nodes[3].value_bytes);
-  this->scaler = bytes_to_int(val_list_entry.nodes[4].value_bytes);
-  SmlNode value_node = val_list_entry.nodes[5];
-  this->value = value_node.value_bytes;
-  this->value_type = value_node.type;
+std::string ObisInfo::code_repr() const {
+  char buffer[20];
+  this->code_repr(buffer, sizeof(buffer));
+  return buffer;
 }
 
-std::string ObisInfo::code_repr() const {
-  return str_sprintf("%d-%d:%d.%d.%d", this->code[0], this->code[1], this->code[2], this->code[3], this->code[4]);
+void ObisInfo::code_repr(char *buffer, size_t size) const {
+  snprintf(buffer, size, "%d-%d:%d.%d.%d", this->code[0], this->code[1], this->code[2], this->code[3], this->code[4]);
 }
 
 }  // namespace sml
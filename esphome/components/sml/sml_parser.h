@@ -11,44 +11,87 @@ namespace sml {
 
 using bytes = std::vector<uint8_t>;
 
+/// Non-owning view of a range of bytes, valid as long as the buffer it points into.
+class BytesView {
+ public:
+  BytesView() = default;
+  BytesView(const uint8_t *data, size_t size) : data_(data), size_(size) {}
+  BytesView(const bytes &buffer) : data_(buffer.data()), size_(buffer.size()) {}  // NOLINT
+
+  const uint8_t *data() const { return this->data_; }
+  size_t size() const { return this->size_; }
+  bool empty() const { return this->size_ == 0; }
+  const uint8_t *begin() const { return this->data_; }
+  const uint8_t *end() const { return this->data_ + this->size_; }
+  uint8_t operator[](size_t index) const { return this->data_[index]; }
+
+ protected:
+  const uint8_t *data_{nullptr};
+  size_t size_{0};
+};
+
+/// Type-length field of an SML element: a value with its bytes, or a list with its number of entries.
 class SmlNode {
  public:
   uint8_t type;
-  bytes value_bytes;
-  std::vector<SmlNode> nodes;
+  BytesView value_bytes;
+  uint8_t entries;
 };
 
 class ObisInfo {
  public:
-  ObisInfo(bytes server_id, SmlNode val_list_entry);
-  bytes server_id;
-  bytes code;
-  bytes status;
+  BytesView server_id;
+  BytesView code;
+  BytesView status;
   char unit;
   char scaler;
-  bytes value;
+  BytesView value;
   uint16_t value_type;
   std::string code_repr() const;
+  /// Write the OBIS code as "A-B:C.D.E" into `buffer`, which should hold at least 20 characters.
+  void code_repr(char *buffer, size_t size) const;
 };
 
+/** Streaming reader for the OBIS values in an SML file.
+ *
+ * Walks the messages in place without building a tree; the returned values point into the buffer, which must outlive
+ * the reader.
+ */
 class SmlFile {
  public:
-  SmlFile(bytes buffer);
-  bool setup_node(SmlNode *node);
-  std::vector<SmlNode> messages;
-  std::vector<ObisInfo> get_obis_info();
+  SmlFile(BytesView buffer);
+  /// Read the next entry of a GetList.Res message, returns false at the end of the file.
+  bool next_obis_info(ObisInfo *obis_info);
 
  protected:
-  const bytes buffer_;
-  size_t pos_;
+  bool read_node_(SmlNode *node);
+  bool skip_node_();
+  bool skip_nodes_(size_t count);
+  /// Move to the value list of the next GetList.Res message.
+  bool next_val_list_();
+  bool read_val_list_entry_(ObisInfo *obis_info);
+
+  const BytesView buffer_;
+  size_t pos_{0};
+  BytesView server_id_;
+  /// Entries left in the current value list.
+  size_t entries_left_{0};
+  /// Elements of the current message that follow its value list.
+  size_t trailing_nodes_{0};
 };
 
-std::string bytes_repr(const bytes &buffer);
+std::string bytes_repr(const BytesView &buffer);
+
+/// Write the lowercase hex representation of `buffer` into `out`, truncated to fit `size` including the terminator.
+void bytes_repr(const BytesView &buffer, char *out, size_t size);
+
+/// Whether `hex` is the lowercase hex representation of `buffer`, as produced by bytes_repr().
+bool bytes_repr_equals(const BytesView &buffer, const std::string &hex);
 
-uint64_t bytes_to_uint(const bytes &buffer);
+uint64_t bytes_to_uint(const BytesView &buffer);
 
-int64_t bytes_to_int(const bytes &buffer);
+int64_t bytes_to_int(const BytesView &buffer);
 
-std::string bytes_to_string(const bytes &buffer);
+std::string bytes_to_string(const BytesView &buffer);
 }  // namespace sml
 }  // namespace esphome
@@ -73,41 +73,9 @@ class LWIPRawImpl : public Socket {
     }
     ip_addr_t ip;
     in_port_t port;
-#if LWIP_IPV6
-    if (family_ == AF_INET) {
-      if (addrlen < sizeof(sockaddr_in)) {
-        errno = EINVAL;
-        return -1;
-      }
-      auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
-      port = ntohs(addr4->sin_port);
-      ip.type = IPADDR_TYPE_V4;
-      ip.u_addr.ip4.addr = addr4->sin_addr.s_addr;
-      LWIP_LOG("tcp_bind(%p ip=%s port=%u)", pcb_, ip4addr_ntoa(&ip.u_addr.ip4), port);
-    } else if (family_ == AF_INET6) {
-      if (addrlen < sizeof(sockaddr_in6)) {
-        errno = EINVAL;
-        return -1;
-      }
-      auto *addr6 = reinterpret_cast<const sockaddr_in6 *>(name);
-      port = ntohs(addr6->sin6_port);
-      ip.type = IPADDR_TYPE_ANY;
-      memcpy(&ip.u_addr.ip6.addr, &addr6->sin6_addr.un.u8_addr, 16);
-      LWIP_LOG("tcp_bind(%p ip=%s port=%u)", pcb_, ip6addr_ntoa(&ip.u_addr.ip6), port);
-    } else {
-      errno = EINVAL;
-      return -1;
-    }
-#else
-    if (family_ != AF_INET) {
-      errno = EINVAL;
+    if (this->sockaddr2ip_(name, addrlen, &ip, &port) != 0)
       return -1;
-    }
-    auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
-    port = ntohs(addr4->sin_port);
-    ip.addr = addr4->sin_addr.s_addr;
-    LWIP_LOG("tcp_bind(%p ip=%u port=%u)", pcb_, ip.addr, port);
-#endif
+    LWIP_LOG("tcp_bind(%p port=%u)", pcb_, port);
     err_t err = tcp_bind(pcb_, &ip, port);
     if (err == ERR_USE) {
       LWIP_LOG("  -> err ERR_USE");
@@ -126,6 +94,42 @@ class LWIPRawImpl : public Socket {
     }
     return 0;
   }
+  int connect(const struct sockaddr *name, socklen_t addrlen) override {
+    if (pcb_ == nullptr) {
+      errno = EBADF;
+      return -1;
+    }
+    if (name == nullptr) {
+      errno = EINVAL;
+      return -1;
+    }
+    ip_addr_t ip;
+    in_port_t port;
+    if (this->sockaddr2ip_(name, addrlen, &ip, &port) != 0)
+      return -1;
+#if LWIP_IPV6
+    // A connection needs a concrete address type, unlike a bind
+    if (ip.type == IPADDR_TYPE_ANY) {
+      if (ip6_addr_isipv4mappedipv6(ip_2_ip6(&ip))) {
+        unmap_ipv4_mapped_ipv6(ip_2_ip4(&ip), ip_2_ip6(&ip));
+        ip.type = IPADDR_TYPE_V4;
+      } else {
+        ip.type = IPADDR_TYPE_V6;
+      }
+    }
+#endif
+    LWIP_LOG("tcp_connect(%p port=%u)", pcb_, port);
+    // Data written before the connection is established is queued by lwIP and sent once it is
+    err_t err = tcp_connect(pcb_, &ip, port, LWIPRawImpl::s_connected_fn);
+    if (err != ERR_OK) {
+      LWIP_LOG("  -> err %d", err);
+      errno = err == ERR_MEM ? ENOMEM : EIO;
+      return -1;
+    }
+    connecting_ = true;
+    errno = EINPROGRESS;
+    return -1;
+  }
   int close() override {
     if (pcb_ == nullptr) {
       errno = ECONNRESET;
@@ -174,6 +178,10 @@ class LWIPRawImpl : public Socket {
       errno = ECONNRESET;
       return -1;
     }
+    if (connecting_) {
+      errno = ENOTCONN;
+      return -1;
+    }
     if (name == nullptr || addrlen == nullptr) {
       errno = EINVAL;
       return -1;
@@ -534,6 +542,12 @@ class LWIPRawImpl : public Socket {
     return arg_this->accept_fn(newpcb, err);
   }
 
+  static err_t s_connected_fn(void *arg, struct tcp_pcb *pcb, err_t err) {
+    LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
+    arg_this->connecting_ = false;
+    return ERR_OK;
+  }
+
   static void s_err_fn(void *arg, err_t err) {
     LWIPRawImpl *arg_this = reinterpret_cast<LWIPRawImpl *>(arg);
     arg_this->err_fn(err);
@@ -545,6 +559,44 @@ class LWIPRawImpl : public Socket {
   }
 
  protected:
+  int sockaddr2ip_(const struct sockaddr *name, socklen_t addrlen, ip_addr_t *ip, in_port_t *port) {
+#if LWIP_IPV6
+    if (family_ == AF_INET) {
+      if (addrlen < sizeof(sockaddr_in)) {
+        errno = EINVAL;
+        return -1;
+      }
+      auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
+      *port = ntohs(addr4->sin_port);
+      ip->type = IPADDR_TYPE_V4;
+      ip->u_addr.ip4.addr = addr4->sin_addr.s_addr;
+      LWIP_LOG("sockaddr(%p ip=%s port=%u)", pcb_, ip4addr_ntoa(&ip->u_addr.ip4), *port);
+    } else if (family_ == AF_INET6) {
+      if (addrlen < sizeof(sockaddr_in6)) {
+        errno = EINVAL;
+        return -1;
+      }
+      auto *addr6 = reinterpret_cast<const sockaddr_in6 *>(name);
+      *port = ntohs(addr6->sin6_port);
+      ip->type = IPADDR_TYPE_ANY;
+      memcpy(&ip->u_addr.ip6.addr, &addr6->sin6_addr.un.u8_addr, 16);
+      LWIP_LOG("sockaddr(%p ip=%s port=%u)", pcb_, ip6addr_ntoa(&ip->u_addr.ip6), *port);
+    } else {
+      errno = EINVAL;
+      return -1;
+    }
+#else
+    if (family_ != AF_INET) {
+      errno = EINVAL;
+      return -1;
+    }
+    auto *addr4 = reinterpret_cast<const sockaddr_in *>(name);
+    *port = ntohs(addr4->sin_port);
+    ip->addr = addr4->sin_addr.s_addr;
+    LWIP_LOG("sockaddr(%p ip=%u port=%u)", pcb_, ip->addr, *port);
+#endif
+    return 0;
+  }
   int ip2sockaddr_(ip_addr_t *ip, uint16_t port, struct sockaddr *name, socklen_t *addrlen) {
     if (family_ == AF_INET) {
       if (*addrlen < sizeof(struct sockaddr_in)) {
@@ -587,6 +639,7 @@ class LWIPRawImpl : public Socket {
 
   struct tcp_pcb *pcb_;
   std::queue<std::unique_ptr<LWIPRawImpl>> accepted_sockets_;
+  bool connecting_ = false;
   bool rx_closed_ = false;
   pbuf *rx_buf_ = nullptr;
   size_t rx_buf_offset_ = 0;
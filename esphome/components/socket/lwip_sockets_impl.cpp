@@ -46,6 +46,7 @@ class LwIPSocketImpl : public Socket {
     return make_unique<LwIPSocketImpl>(fd);
   }
   int bind(const struct sockaddr *addr, socklen_t addrlen) override { return lwip_bind(fd_, addr, addrlen); }
+  int connect(const struct sockaddr *addr, socklen_t addrlen) override { return lwip_connect(fd_, addr, addrlen); }
   int close() override {
     int ret = lwip_close(fd_);
     closed_ = true;
@@ -29,6 +29,8 @@ socklen_t set_sockaddr(struct sockaddr *addr, socklen_t addrlen, const std::stri
   server->sin6_port = htons(port);
 
   if (ip_address.find('.') != std::string::npos) {
+    // IPv4-mapped IPv6 address
+    server->sin6_addr.un.u32_addr[2] = htonl(0xFFFF);
     server->sin6_addr.un.u32_addr[3] = inet_addr(ip_address.c_str());
   } else {
     ip6_addr_t ip6;
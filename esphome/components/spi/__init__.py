@@ -28,6 +28,7 @@ from esphome.const import (
     CONF_DATA_RATE,
     PLATFORM_ESP32,
     PLATFORM_ESP8266,
+    PLATFORM_HOST,
     PLATFORM_RP2040,
 )
 from esphome.core import coroutine_with_priority, CORE
@@ -118,6 +119,8 @@ def get_hw_interface_list():
         return [["spi", "spi2"], ["spi3"]]
     if target_platform == PLATFORM_RP2040:
         return [["spi"], ["spi1"]]
+    if target_platform == PLATFORM_HOST:
+        return [["host"]]
     return []
 
 
@@ -176,6 +179,10 @@ def validate_hw_pins(spi, index=-1):
         if sdi_pin_no not in pin_set[CONF_MISO_PIN]:
             return False
         return True
+
+    if target_platform == PLATFORM_HOST:
+        # The bus is simulated, any pins will do
+        return True
     return False
 
 
@@ -235,6 +242,8 @@ def validate_spi_config(config):
 
 # Given an SPI index, convert to a string that represents the C++ object for it.
 def get_spi_interface(index):
+    if CORE.is_host:
+        return str(index)
     if CORE.using_esp_idf:
         return ["SPI2_HOST", "SPI3_HOST"][index]
     # Arduino code follows
@@ -264,7 +273,7 @@ SPI_SCHEMA = cv.All(
         }
     ),
     cv.has_at_least_one_key(CONF_MISO_PIN, CONF_MOSI_PIN),
-    cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_RP2040]),
+    cv.only_on([PLATFORM_ESP32, PLATFORM_ESP8266, PLATFORM_RP2040, PLATFORM_HOST]),
 )
 
 CONFIG_SCHEMA = cv.All(
@@ -1,6 +1,7 @@
 #include "spi.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <algorithm>
 
 namespace esphome {
 namespace spi {
@@ -13,6 +14,20 @@ SPIDelegate *const SPIDelegate::NULL_DELEGATE =  // NOLINT(cppcoreguidelines-avo
 
 bool SPIDelegate::is_ready() { return true; }
 
+size_t SPIDelegate::queue_transfer(const SPIDescriptor &descriptor) {
+  if (descriptor.tx_buffer != nullptr && descriptor.rx_buffer != nullptr) {
+    this->transfer(descriptor.tx_buffer, descriptor.rx_buffer, descriptor.length);
+  } else if (descriptor.tx_buffer != nullptr) {
+    this->write_array(descriptor.tx_buffer, descriptor.length);
+  } else if (descriptor.rx_buffer != nullptr) {
+    this->read_array(descriptor.rx_buffer, descriptor.length);
+  } else {
+    for (size_t i = 0; i != descriptor.length; i++)
+      this->transfer(0);
+  }
+  return descriptor.length;
+}
+
 GPIOPin *const NullPin::NULL_PIN = new NullPin();  // NOLINT(cppcoreguidelines-avoid-non-const-global-variables)
 
 SPIDelegate *SPIComponent::register_device(SPIClient *device, SPIMode mode, SPIBitOrder bit_order, uint32_t data_rate,
@@ -31,6 +46,8 @@ void SPIComponent::unregister_device(SPIClient *device) {
     esph_log_e(TAG, "SPI device not registered");
     return;
   }
+  // Queued transactions may still refer to the delegate
+  this->flush_queue();
   delete this->devices_[device];  // NOLINT
   this->devices_.erase(device);
 }
@@ -63,6 +80,96 @@ void SPIComponent::setup() {
   }
 }
 
+bool SPIComponent::queue_transaction(SPIDelegate *delegate, const SPIDescriptor *descriptors, size_t count,
+                                     spi_callback_t &&callback) {
+  if (count > MAX_DESCRIPTORS) {
+    ESP_LOGE(TAG, "Too many descriptors in SPI transaction: %zu", count);
+    return false;
+  }
+  if (this->queue_size_ == TRANSACTION_QUEUE_LENGTH)
+    return false;
+  auto &transaction = this->queue_[(this->queue_head_ + this->queue_size_) % TRANSACTION_QUEUE_LENGTH];
+  transaction.delegate = delegate;
+  std::copy(descriptors, descriptors + count, transaction.descriptors);
+  transaction.count = count;
+  transaction.next = 0;
+  transaction.offset = 0;
+  transaction.started = false;
+  transaction.failed = false;
+  transaction.callback = std::move(callback);
+  this->queue_size_++;
+  // Start a transaction on an idle bus right away; it completes, and its callback runs, from loop()
+  if (this->queue_size_ == this->queue_done_ + 1)
+    this->start_transfers_(transaction);
+  return true;
+}
+
+void SPIComponent::loop() {
+  if (this->queue_size_ != 0)
+    this->run_queue_(false);
+}
+
+void SPIComponent::run_queue_(bool wait) {
+  while (this->queue_done_ != this->queue_size_) {
+    auto &transaction = this->queue_[(this->queue_head_ + this->queue_done_) % TRANSACTION_QUEUE_LENGTH];
+    this->start_transfers_(transaction);
+    const bool all_started = transaction.next == transaction.count;
+    if (!transaction.delegate->transfers_done(wait) || !all_started) {
+      if (!wait)
+        break;
+      // The delegate has room for the rest of the descriptors now
+      continue;
+    }
+    transaction.delegate->end_transaction();
+    this->queue_done_++;
+  }
+  // A device waiting for the bus in enable() must not run the callbacks of other devices
+  if (wait)
+    return;
+
+  while (this->queue_done_ != 0) {
+    auto &transaction = this->queue_[this->queue_head_];
+    auto callback = std::move(transaction.callback);
+    const bool success = !transaction.failed;
+    transaction.callback = nullptr;
+    this->queue_head_ = (this->queue_head_ + 1) % TRANSACTION_QUEUE_LENGTH;
+    this->queue_size_--;
+    this->queue_done_--;
+    // The callback may queue the next transaction, which starts right away if the bus is idle
+    if (callback)
+      callback(success);
+  }
+}
+
+void SPIComponent::start_transfers_(QueuedTransaction &transaction) {
+  if (!transaction.started) {
+    transaction.delegate->begin_transaction();
+    transaction.started = true;
+  }
+  while (transaction.next != transaction.count) {
+    const auto &descriptor = transaction.descriptors[transaction.next];
+    if (transaction.offset < descriptor.length) {
+      SPIDescriptor rest{descriptor.tx_buffer == nullptr ? nullptr : descriptor.tx_buffer + transaction.offset,
+                         descriptor.rx_buffer == nullptr ? nullptr : descriptor.rx_buffer + transaction.offset,
+                         descriptor.length - transaction.offset};
+      const size_t started = transaction.delegate->queue_transfer(rest);
+      if (started == 0)
+        return;
+      if (started == SPIDelegate::TRANSFER_FAILED) {
+        // Finish the transaction with what is already in flight
+        transaction.failed = true;
+        transaction.next = transaction.count;
+        return;
+      }
+      transaction.offset += started;
+      if (transaction.offset < descriptor.length)
+        continue;
+    }
+    transaction.next++;
+    transaction.offset = 0;
+  }
+}
+
 void SPIComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "SPI bus:");
   LOG_PIN("  CLK Pin: ", this->clk_pin_)
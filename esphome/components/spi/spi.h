@@ -4,6 +4,8 @@
 #include "esphome/core/hal.h"
 #include "esphome/core/log.h"
 #include "esphome/core/application.h"
+#include <cstdint>
+#include <functional>
 #include <vector>
 #include <map>
 
@@ -27,6 +29,13 @@ using SPIInterface = spi_host_device_t;
 
 #endif  // USE_ESP_IDF
 
+#ifdef USE_HOST
+
+/// Index of the simulated bus.
+using SPIInterface = uint8_t;
+
+#endif  // USE_HOST
+
 /**
  * Implementation of SPI Controller mode.
  */
@@ -162,6 +171,27 @@ class Utility {
   }
 };
 
+/// A buffer of a queued transaction. Zeros are written if `tx_buffer` is null, the data read is discarded if
+/// `rx_buffer` is.
+struct SPIDescriptor {
+  const uint8_t *tx_buffer;
+  uint8_t *rx_buffer;
+  size_t length;
+};
+
+/// Called from loop() when a queued transaction is done; `success` is false if not all of its data was transferred.
+using spi_callback_t = std::function<void(bool success)>;
+
+#ifdef USE_HOST
+/// A transaction seen by the simulated host bus, with the bus time it took.
+struct SPITransactionRecord {
+  GPIOPin *cs_pin;
+  size_t bytes;
+  uint32_t start_us;
+  uint32_t end_us;
+};
+#endif
+
 class SPIDelegateDummy;
 
 // represents a device attached to an SPI bus, with a defined clock rate, mode and bit order. On Arduino this is
@@ -231,6 +261,18 @@ class SPIDelegate {
   // check if device is ready
   virtual bool is_ready();
 
+  static const size_t TRANSFER_FAILED = SIZE_MAX;
+
+  /** Start transferring the beginning of `descriptor` without waiting for it to finish.
+   *
+   * Returns the number of bytes started, 0 if earlier transfers have to finish first, or TRANSFER_FAILED if the
+   * transfer can't be started at all. The default implementation transfers the whole descriptor before returning.
+   */
+  virtual size_t queue_transfer(const SPIDescriptor &descriptor);
+
+  /// Whether all transfers started with queue_transfer() have finished; with `wait` block until they have.
+  virtual bool transfers_done(bool wait) { return true; }
+
  protected:
   SPIBitOrder bit_order_{BIT_ORDER_MSB_FIRST};
   uint32_t data_rate_{1000000};
@@ -312,6 +354,22 @@ class SPIComponent : public Component {
                                GPIOPin *cs_pin);
   void unregister_device(SPIClient *device);
 
+  /** Queue a transaction: the descriptors are transferred in one chip select window of `delegate`, once the
+   * transactions queued before it on this bus are done. `callback` runs from loop() when the transaction is done,
+   * in the order the transactions were queued. If a transfer fails, the rest of the transaction is skipped and the
+   * callback gets `false`.
+   *
+   * The buffers must stay valid until then. Returns false if the queue is full or there are too many descriptors.
+   */
+  bool queue_transaction(SPIDelegate *delegate, const SPIDescriptor *descriptors, size_t count,
+                         spi_callback_t &&callback);
+  /// Wait until the queued transactions are done, so the bus can be used synchronously. Their callbacks still run
+  /// from loop().
+  void flush_queue() {
+    if (this->queue_done_ != this->queue_size_)
+      this->run_queue_(true);
+  }
+
   void set_clk(GPIOPin *clk) { this->clk_pin_ = clk; }
 
   void set_miso(GPIOPin *sdi) { this->sdi_pin_ = sdi; }
@@ -325,12 +383,42 @@ class SPIComponent : public Component {
 
   void set_interface_name(const char *name) { this->interface_name_ = name; }
 
+#ifdef USE_HOST
+  /// The most recent transactions of the simulated bus, oldest first.
+  const std::vector<SPITransactionRecord> &get_transaction_log() const;
+  void clear_transaction_log();
+#endif
+
   float get_setup_priority() const override { return setup_priority::BUS; }
 
   void setup() override;
+  void loop() override;
   void dump_config() override;
 
  protected:
+  static const size_t TRANSACTION_QUEUE_LENGTH = 8;
+  static const size_t MAX_DESCRIPTORS = 4;
+
+  struct QueuedTransaction {
+    SPIDelegate *delegate;
+    SPIDescriptor descriptors[MAX_DESCRIPTORS];
+    uint8_t count;
+    /// Index of the descriptor to start next, and how many of its bytes have been started.
+    uint8_t next;
+    size_t offset;
+    bool started;
+    bool failed;
+    spi_callback_t callback;
+  };
+
+  /** Advance the queued transactions and, unless `wait` is set, run the callbacks of the finished ones.
+   *
+   * With `wait` block until all of them are done instead; the callbacks then run on the next loop().
+   */
+  void run_queue_(bool wait);
+  /// Begin the transaction and start transferring as many of its descriptors as the delegate takes.
+  void start_transfers_(QueuedTransaction &transaction);
+
   GPIOPin *clk_pin_{nullptr};
   GPIOPin *sdi_pin_{nullptr};
   GPIOPin *sdo_pin_{nullptr};
@@ -339,6 +427,11 @@ class SPIComponent : public Component {
   const char *interface_name_{nullptr};
   SPIBus *spi_bus_{};
   std::map<SPIClient *, SPIDelegate *> devices_;
+  QueuedTransaction queue_[TRANSACTION_QUEUE_LENGTH]{};
+  size_t queue_head_{0};
+  size_t queue_size_{0};
+  /// Transactions at the front of the queue that are done and wait for their callbacks.
+  size_t queue_done_{0};
 
   static SPIBus *get_bus(SPIInterface interface, GPIOPin *clk, GPIOPin *sdo, GPIOPin *sdi);
 };
@@ -397,6 +490,7 @@ class SPIDevice : public SPIClient {
   void set_spi_parent(SPIComponent *parent) { this->parent_ = parent; }
 
   void set_cs_pin(GPIOPin *cs) { this->cs_ = cs; }
+  GPIOPin *get_cs_pin() const { return this->cs_; }
 
   void set_data_rate(uint32_t data_rate) { this->data_rate_ = data_rate; }
 
@@ -420,7 +514,10 @@ class SPIDevice : public SPIClient {
   // avoid use of this if possible. It's inefficient and ugly.
   void write_array16(const uint16_t *data, size_t length) { this->delegate_->write_array16(data, length); }
 
-  void enable() { this->delegate_->begin_transaction(); }
+  void enable() {
+    this->parent_->flush_queue();
+    this->delegate_->begin_transaction();
+  }
 
   void disable() { this->delegate_->end_transaction(); }
 
@@ -431,6 +528,20 @@ class SPIDevice : public SPIClient {
   void write_array(const std::vector<uint8_t> &data) { this->write_array(data.data(), data.size()); }
 
   template<size_t N> void transfer_array(std::array<uint8_t, N> &data) { this->transfer_array(data.data(), N); }
+
+  /** Queue a transaction of this device instead of transferring the data right away; DMA is used where available.
+   *
+   * See SPIComponent::queue_transaction(). Don't call enable() or disable() around it.
+   */
+  bool queue_transaction(const SPIDescriptor *descriptors, size_t count, spi_callback_t &&callback = nullptr) {
+    return this->parent_->queue_transaction(this->delegate_, descriptors, count, std::move(callback));
+  }
+
+  /// Queue writing `length` bytes from `data`, which must stay valid until `callback` runs.
+  bool queue_write_array(const uint8_t *data, size_t length, spi_callback_t &&callback = nullptr) {
+    SPIDescriptor descriptor{data, nullptr, length};
+    return this->queue_transaction(&descriptor, 1, std::move(callback));
+  }
 };
 
 }  // namespace spi
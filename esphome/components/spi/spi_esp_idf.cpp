@@ -7,6 +7,7 @@ namespace spi {
 #ifdef USE_ESP_IDF
 static const char *const TAG = "spi-esp-idf";
 static const size_t MAX_TRANSFER_SIZE = 4092;  // dictated by ESP-IDF API.
+static const size_t QUEUE_SIZE = 4;            // transfers of a device that DMA can run without the CPU
 
 class SPIDelegateHw : public SPIDelegate {
  public:
@@ -18,7 +19,7 @@ class SPIDelegateHw : public SPIDelegate {
     config.clock_speed_hz = static_cast<int>(data_rate);
     config.spics_io_num = -1;
     config.flags = 0;
-    config.queue_size = 1;
+    config.queue_size = QUEUE_SIZE;
     config.pre_cb = nullptr;
     config.post_cb = nullptr;
     if (bit_order == BIT_ORDER_LSB_FIRST)
@@ -64,6 +65,8 @@ class SPIDelegateHw : public SPIDelegate {
       ESP_LOGE(TAG, "Attempted read from write-only channel");
       return;
     }
+    // spi_device_transmit() expects no queued transfers of the device to be pending
+    this->collect_results_(true);
     spi_transaction_t desc = {};
     desc.flags = 0;
     while (length != 0) {
@@ -122,10 +125,53 @@ class SPIDelegateHw : public SPIDelegate {
 
   void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
 
+  size_t queue_transfer(const SPIDescriptor &descriptor) override {
+    if (descriptor.rx_buffer != nullptr && this->write_only_) {
+      ESP_LOGE(TAG, "Attempted read from write-only channel");
+      return TRANSFER_FAILED;
+    }
+    this->collect_results_(false);
+    if (this->in_flight_ == QUEUE_SIZE)
+      return 0;
+    // Results come back in the order the transfers were queued, so the slot after the newest one is free
+    spi_transaction_t &desc = this->queued_[(this->oldest_slot_ + this->in_flight_) % QUEUE_SIZE];
+    desc = {};
+    size_t const partial = std::min(descriptor.length, MAX_TRANSFER_SIZE);
+    desc.length = partial * 8;
+    desc.rxlength = this->write_only_ ? 0 : partial * 8;
+    desc.tx_buffer = descriptor.tx_buffer;
+    desc.rx_buffer = descriptor.rx_buffer;
+    esp_err_t const err = spi_device_queue_trans(this->handle_, &desc, 0);
+    if (err != ESP_OK) {
+      ESP_LOGE(TAG, "Queueing transfer failed - err %X", err);
+      return TRANSFER_FAILED;
+    }
+    this->in_flight_++;
+    return partial;
+  }
+
+  bool transfers_done(bool wait) override {
+    this->collect_results_(wait);
+    return this->in_flight_ == 0;
+  }
+
  protected:
+  void collect_results_(bool wait) {
+    spi_transaction_t *result;
+    while (this->in_flight_ != 0 &&
+           spi_device_get_trans_result(this->handle_, &result, wait ? portMAX_DELAY : 0) == ESP_OK) {
+      this->in_flight_--;
+      this->oldest_slot_ = (this->oldest_slot_ + 1) % QUEUE_SIZE;
+    }
+  }
+
   SPIInterface channel_{};
   spi_device_handle_t handle_{};
   bool write_only_{false};
+  spi_transaction_t queued_[QUEUE_SIZE]{};
+  /// Slot of the oldest transfer in flight.
+  size_t oldest_slot_{0};
+  size_t in_flight_{0};
 };
 
 class SPIBusHw : public SPIBus {
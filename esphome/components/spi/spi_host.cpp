@@ -0,0 +1,155 @@
+#include "spi.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstring>
+
+namespace esphome {
+namespace spi {
+
+#ifdef USE_HOST
+static const char *const TAG = "spi-host";
+static const uint32_t STATS_INTERVAL = 60000;
+static const size_t TRANSACTION_LOG_LENGTH = 128;
+
+static void wait_until(uint32_t end_us) {
+  const int32_t remaining = int32_t(end_us - micros());
+  if (remaining > 0)
+    delayMicroseconds(remaining);
+}
+
+/** Simulated SPI bus on the host. Keeps the bus busy for as long as a real one would be, and records the chip select,
+ * length and bus time of the most recent transactions for host tests.
+ */
+class SPIBusHost : public SPIBus {
+ public:
+  SPIBusHost(GPIOPin *clk, GPIOPin *sdo, GPIOPin *sdi) : SPIBus(clk, sdo, sdi) {}
+
+  SPIDelegate *get_delegate(uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin) override;
+
+  /// Occupy the bus with a transfer of `length` bytes after the earlier ones; returns when it ends, in µs.
+  uint32_t record_transfer(size_t length, uint32_t data_rate) {
+    const uint32_t now = micros();
+    const uint32_t start = int32_t(this->busy_until_ - now) > 0 ? this->busy_until_ : now;
+    const auto duration = uint32_t((uint64_t(length) * 8000000 + data_rate - 1) / data_rate);
+    this->busy_until_ = start + duration;
+    this->busy_us_ += duration;
+    this->bytes_ += length;
+    if (!this->log_.empty()) {
+      SPITransactionRecord &record = this->log_.back();
+      if (record.bytes == 0)
+        record.start_us = start;
+      record.bytes += length;
+      record.end_us = this->busy_until_;
+    }
+    return this->busy_until_;
+  }
+
+  void record_transaction(GPIOPin *cs_pin) {
+    this->transactions_++;
+    if (this->log_.size() == TRANSACTION_LOG_LENGTH)
+      this->log_.erase(this->log_.begin());
+    const uint32_t now_us = micros();
+    this->log_.push_back({cs_pin, 0, now_us, now_us});
+    const uint32_t now = millis();
+    if (now - this->stats_start_ >= STATS_INTERVAL)
+      this->log_stats_(now);
+  }
+
+  const std::vector<SPITransactionRecord> &get_log() const { return this->log_; }
+  void clear_log() { this->log_.clear(); }
+
+ protected:
+  bool is_hw() override { return true; }
+
+  void log_stats_(uint32_t now) {
+    ESP_LOGD(TAG, "%" PRIu32 " transactions, %" PRIu32 " bytes, bus utilization %.1f%%", this->transactions_,
+             this->bytes_, std::min(float(this->busy_us_) / float(now - this->stats_start_) * 0.1f, 100.0f));
+    this->stats_start_ = now;
+    this->transactions_ = 0;
+    this->bytes_ = 0;
+    this->busy_us_ = 0;
+  }
+
+  uint32_t busy_until_{0};
+  uint32_t stats_start_{0};
+  uint32_t transactions_{0};
+  uint32_t bytes_{0};
+  uint32_t busy_us_{0};
+  std::vector<SPITransactionRecord> log_;
+};
+
+class SPIDelegateHost : public SPIDelegate {
+ public:
+  SPIDelegateHost(SPIBusHost *bus, uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin)
+      : SPIDelegate(data_rate, bit_order, mode, cs_pin), bus_(bus) {}
+
+  void begin_transaction() override {
+    this->bus_->record_transaction(this->cs_pin_);
+    SPIDelegate::begin_transaction();
+  }
+
+  void end_transaction() override {
+    SPIDelegate::end_transaction();
+#ifdef ESPHOME_LOG_HAS_VERY_VERBOSE
+    const SPITransactionRecord &record = this->bus_->get_log().back();
+    ESP_LOGVV(TAG, "Transaction on %s: %zu bytes, %" PRIu32 "-%" PRIu32 " us", this->cs_pin_->dump_summary().c_str(),
+              record.bytes, record.start_us, record.end_us);
+#endif
+  }
+
+  // Nothing drives the input of the simulated bus, so all data read is 0.
+  uint8_t transfer(uint8_t data) override {
+    wait_until(this->record_(1));
+    return 0;
+  }
+
+  void transfer(const uint8_t *txbuf, uint8_t *rxbuf, size_t length) override {
+    if (rxbuf != nullptr)
+      memset(rxbuf, 0, length);
+    wait_until(this->record_(length));
+  }
+
+  void transfer(uint8_t *ptr, size_t length) override { this->transfer(ptr, ptr, length); }
+
+  void write_array(const uint8_t *ptr, size_t length) override { wait_until(this->record_(length)); }
+
+  void read_array(uint8_t *ptr, size_t length) override { this->transfer(nullptr, ptr, length); }
+
+  // Queued transfers run in the background, like DMA.
+  size_t queue_transfer(const SPIDescriptor &descriptor) override {
+    if (descriptor.rx_buffer != nullptr)
+      memset(descriptor.rx_buffer, 0, descriptor.length);
+    this->queued_until_ = this->record_(descriptor.length);
+    return descriptor.length;
+  }
+
+  bool transfers_done(bool wait) override {
+    if (wait)
+      wait_until(this->queued_until_);
+    return int32_t(this->queued_until_ - micros()) <= 0;
+  }
+
+ protected:
+  uint32_t record_(size_t length) { return this->bus_->record_transfer(length, this->data_rate_); }
+
+  SPIBusHost *bus_;
+  uint32_t queued_until_{0};
+};
+
+SPIDelegate *SPIBusHost::get_delegate(uint32_t data_rate, SPIBitOrder bit_order, SPIMode mode, GPIOPin *cs_pin) {
+  return new SPIDelegateHost(this, data_rate, bit_order, mode, cs_pin);
+}
+
+SPIBus *SPIComponent::get_bus(SPIInterface interface, GPIOPin *clk, GPIOPin *sdo, GPIOPin *sdi) {
+  return new SPIBusHost(clk, sdo, sdi);
+}
+
+const std::vector<SPITransactionRecord> &SPIComponent::get_transaction_log() const {
+  return static_cast<SPIBusHost *>(this->spi_bus_)->get_log();
+}
+
+void SPIComponent::clear_transaction_log() { static_cast<SPIBusHost *>(this->spi_bus_)->clear_log(); }
+
+#endif  // USE_HOST
+}  // namespace spi
+}  // namespace esphome
@@ -13,6 +13,7 @@ CONFIG_SCHEMA = light.ADDRESSABLE_LIGHT_SCHEMA.extend(
     {
         cv.GenerateID(CONF_OUTPUT_ID): cv.declare_id(SpiLedStrip),
         cv.Optional(CONF_NUM_LEDS, default=1): cv.positive_not_null_int,
+        cv.Optional(light.CONF_FRAME_GROUP): cv.validate_id_name,
     }
 ).extend(spi.spi_device_schema(False, "1MHz"))
 
@@ -23,3 +24,5 @@ async def to_code(config):
     await light.register_light(var, config)
     await spi.register_spi_device(var, config)
     await cg.register_component(var, config)
+    if light.CONF_FRAME_GROUP in config:
+        light.add_to_frame_group(var, config[light.CONF_FRAME_GROUP])
@@ -33,6 +33,14 @@ class SpiLedStrip : public light::AddressableLight,
       return;
     }
 
+    // Queued frames are sent from this copy, so effects can keep changing buf_ in the meantime
+    this->tx_buf_ = allocator.allocate(this->buffer_size_);
+    if (this->tx_buf_ == nullptr) {
+      esph_log_e(TAG, "Failed to allocate transmit buffer of size %u", this->buffer_size_);
+      this->mark_failed();
+      return;
+    }
+
     this->effect_data_ = allocator.allocate(num_leds);
     if (this->effect_data_ == nullptr) {
       esph_log_e(TAG, "Failed to allocate effect data of size %u", num_leds);
@@ -55,6 +63,27 @@ class SpiLedStrip : public light::AddressableLight,
   void write_state(light::LightState *state) override {
     if (this->is_failed())
       return;
+    if (this->frame_group_ != nullptr) {
+      this->request_group_frame_();
+      return;
+    }
+    // Don't block the main loop while the previous frame is still queued; the newest data goes out next time
+    if (this->is_sending_()) {
+      this->record_frame_deferred_();
+      return;
+    }
+    this->send_frame_();
+  }
+
+  void clear_effect_data() override {
+    for (int i = 0; i < this->size(); i++)
+      this->effect_data_[i] = 0;
+  }
+
+ protected:
+  bool is_sending_() override { return this->sending_; }
+  uint32_t get_frame_checksum_() override { return frame_checksum_(this->buf_, this->buffer_size_); }
+  void send_frame_() override {
     if (ESPHOME_LOG_LEVEL >= ESPHOME_LOG_LEVEL_VERBOSE) {
       char strbuf[49];
       size_t len = std::min(this->buffer_size_, (size_t) (sizeof(strbuf) - 1) / 3);
@@ -64,27 +93,39 @@ class SpiLedStrip : public light::AddressableLight,
       }
       esph_log_v(TAG, "write_state: buf = %s", strbuf);
     }
-    this->enable();
-    this->write_array(this->buf_, this->buffer_size_);
-    this->disable();
-  }
-
-  void clear_effect_data() override {
-    for (int i = 0; i < this->size(); i++)
-      this->effect_data_[i] = 0;
+    memcpy(this->tx_buf_, this->buf_, this->buffer_size_);
+    if (!this->queue_write_array(this->tx_buf_, this->buffer_size_, [this](bool success) {
+          this->sending_ = false;
+          if (!success)
+            esph_log_w(TAG, "Sending the frame failed");
+        })) {
+      // The bus queue is full; try again next loop iteration
+      this->record_frame_deferred_();
+      return;
+    }
+    this->sending_ = true;
+    this->mark_shown_();
+    this->record_frame_shown_();
   }
 
- protected:
   light::ESPColorView get_view_internal(int32_t index) const override {
     size_t pos = index * 4 + 5;
     return {this->buf_ + pos + 2,       this->buf_ + pos + 1, this->buf_ + pos + 0, nullptr,
             this->effect_data_ + index, &this->correction_};
   }
+  light::ESPColorSpan get_span_internal() const override {
+    if (this->buf_ == nullptr)
+      return {};
+    // Every LED frame starts with a brightness byte, so the span isn't packed
+    return {this->buf_ + 5, this->size(), 4, 2, 1, 0};
+  }
 
   size_t buffer_size_{};
   uint8_t *effect_data_{nullptr};
   uint8_t *buf_{nullptr};
+  uint8_t *tx_buf_{nullptr};
   uint16_t num_leds_;
+  bool sending_{false};
 };
 
 }  // namespace spi_led_strip
@@ -1,5 +1,6 @@
 #include "ssd1306_base.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -228,7 +229,9 @@ bool SSD1306::is_ssd1305_() const {
 }
 void SSD1306::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 
 void SSD1306::set_invert(bool invert) {
@@ -1,5 +1,6 @@
 #include "ssd1322_base.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -123,7 +124,9 @@ void SSD1322::display() {
 }
 void SSD1322::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 void SSD1322::set_brightness(float brightness) {
   this->brightness_ = clamp(brightness, 0.0F, 1.0F);
@@ -1,5 +1,6 @@
 #include "ssd1327_base.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -97,7 +98,9 @@ void SSD1327::display() {
 void SSD1327::update() {
   if (!this->is_failed()) {
     this->do_update_();
+    const uint32_t flush_start = micros();
     this->display();
+    this->record_flush_time_(flush_start);
   }
 }
 void SSD1327::set_brightness(float brightness) {
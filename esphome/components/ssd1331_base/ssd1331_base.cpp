@@ -1,5 +1,6 @@
 #include "ssd1331_base.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -91,7 +92,9 @@ void SSD1331::display() {
 }
 void SSD1331::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 void SSD1331::set_brightness(float brightness) {
   // validation
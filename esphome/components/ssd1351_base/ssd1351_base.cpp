@@ -1,5 +1,6 @@
 #include "ssd1351_base.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/helpers.h"
 
 namespace esphome {
@@ -101,7 +102,9 @@ void SSD1351::display() {
 }
 void SSD1351::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 void SSD1351::set_brightness(float brightness) {
   // validation
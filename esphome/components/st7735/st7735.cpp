@@ -293,7 +293,9 @@ void ST7735::setup() {
 
 void ST7735::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->write_display_data_();
+  this->record_flush_time_(flush_start);
 }
 
 int ST7735::get_height_internal() { return height_; }
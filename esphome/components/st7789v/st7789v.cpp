@@ -1,5 +1,6 @@
 #include "st7789v.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 
 namespace esphome {
 namespace st7789v {
@@ -143,16 +144,26 @@ float ST7789V::get_setup_priority() const { return setup_priority::PROCESSOR; }
 
 void ST7789V::update() {
   this->do_update_();
-  this->write_display_data();
+  // Only the widgets that were redrawn are sent; nothing at all if none were
+  const display::Rect damage = this->get_damage_internal_();
+  if (!damage.is_set())
+    return;
+  const uint32_t flush_start = micros();
+  this->write_display_window_(damage);
+  this->record_flush_time_(flush_start);
 }
 
 void ST7789V::set_model_str(const char *model_str) { this->model_str_ = model_str; }
 
 void ST7789V::write_display_data() {
-  uint16_t x1 = this->offset_height_;
-  uint16_t x2 = x1 + get_width_internal() - 1;
-  uint16_t y1 = this->offset_width_;
-  uint16_t y2 = y1 + get_height_internal() - 1;
+  this->write_display_window_(display::Rect(0, 0, this->get_width_internal(), this->get_height_internal()));
+}
+
+void ST7789V::write_display_window_(const display::Rect &window) {
+  uint16_t x1 = this->offset_height_ + window.x;
+  uint16_t x2 = x1 + window.w - 1;
+  uint16_t y1 = this->offset_width_ + window.y;
+  uint16_t y2 = y1 + window.h - 1;
 
   this->enable();
 
@@ -171,11 +182,12 @@ void ST7789V::write_display_data() {
   this->write_byte(ST7789_RAMWR);
   this->dc_pin_->digital_write(true);
 
+  const int width = this->get_width_internal();
   if (this->eightbitcolor_) {
     uint8_t temp_buffer[TEMP_BUFFER_SIZE];
     size_t temp_index = 0;
-    for (int line = 0; line < this->get_buffer_length_(); line = line + this->get_width_internal()) {
-      for (int index = 0; index < this->get_width_internal(); ++index) {
+    for (int line = window.y * width; line < window.y2() * width; line = line + width) {
+      for (int index = window.x; index < window.x2(); ++index) {
         auto color = display::ColorUtil::color_to_565(
             display::ColorUtil::to_color(this->buffer_[index + line], display::ColorOrder::COLOR_ORDER_RGB,
                                          display::ColorBitness::COLOR_BITNESS_332, true));
@@ -189,8 +201,11 @@ void ST7789V::write_display_data() {
     }
     if (temp_index != 0)
       this->write_array(temp_buffer, temp_index);
+  } else if (window.x == 0 && window.w == width) {
+    this->write_array(this->buffer_ + window.y * width * 2, window.h * width * 2);
   } else {
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    for (int y = window.y; y < window.y2(); y++)
+      this->write_array(this->buffer_ + (y * width + window.x) * 2, window.w * 2);
   }
 
   this->disable();
@@ -156,6 +156,8 @@ class ST7789V : public PollingComponent,
   void write_command_(uint8_t value);
   void write_data_(uint8_t value);
   void write_addr_(uint16_t addr1, uint16_t addr2);
+  /// Send the given part of the buffer, in buffer coordinates.
+  void write_display_window_(const display::Rect &window);
   void write_color_(uint16_t color, uint16_t size);
 
   int get_height_internal() override { return this->height_; }
@@ -22,6 +22,14 @@ i2c::ErrorCode TCA9548AChannel::writev(uint8_t address, i2c::WriteBuffer *buffer
   this->parent_->disable_all_channels();
   return err;
 }
+void TCA9548AChannel::schedule_transaction(const void *owner, uint32_t delay_ms,
+                                           std::function<void()> &&transaction) {
+  // Transactions on the channels run from the loop of the upstream bus
+  this->parent_->get_i2c_bus()->schedule_transaction(owner, delay_ms, std::move(transaction));
+}
+void TCA9548AChannel::cancel_transaction(const void *owner) {
+  this->parent_->get_i2c_bus()->cancel_transaction(owner);
+}
 
 void TCA9548AComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up TCA9548A...");
@@ -5,6 +5,8 @@
 #include "esphome/core/log.h"
 #include "esphome/core/util.h"
 
+#include <algorithm>
+
 #ifdef USE_WIFI
 #include "esphome/components/wifi/wifi_component.h"
 #endif
@@ -20,19 +22,22 @@ static const char *const TAG = "tuya";
 static const int COMMAND_DELAY = 10;
 static const int RECEIVE_TIMEOUT = 300;
 static const int MAX_RETRIES = 5;
+static const uint32_t STATS_INTERVAL = 60000;
 
 void Tuya::setup() {
   this->set_interval("heartbeat", 15000, [this] { this->send_empty_command_(TuyaCommandType::HEARTBEAT); });
+  this->set_interval("stats", STATS_INTERVAL, [this] { this->log_stats_(); });
   if (this->status_pin_.has_value()) {
     this->status_pin_.value()->digital_write(false);
   }
 }
 
 void Tuya::loop() {
-  while (this->available()) {
-    uint8_t c;
-    this->read_byte(&c);
-    this->handle_char_(c);
+  const uint8_t *data;
+  while (size_t len = this->peek_span(&data)) {
+    for (size_t i = 0; i < len; i++)
+      this->handle_char_(data[i]);
+    this->consume(len);
   }
   process_command_queue_();
 }
@@ -126,6 +131,7 @@ bool Tuya::validate_message_() {
   const uint8_t *message_data = data + 6;
   ESP_LOGV(TAG, "Received Tuya: CMD=0x%02X VERSION=%u DATA=[%s] INIT_STATE=%u", command, version,
            format_hex_pretty(message_data, length).c_str(), static_cast<uint8_t>(this->init_state_));
+  this->messages_received_++;
   this->handle_command_(command, version, message_data, length);
 
   // return false to reset rx buffer
@@ -146,7 +152,7 @@ void Tuya::handle_command_(uint8_t command, uint8_t version, const uint8_t *buff
 
   if (this->expected_response_.has_value() && this->expected_response_ == command_type) {
     this->expected_response_.reset();
-    this->command_queue_.erase(command_queue_.begin());
+    this->pop_command_();
     this->init_retries_ = 0;
   }
 
@@ -351,6 +357,7 @@ void Tuya::handle_datapoints_(const uint8_t *buffer, size_t len) {
 
     len -= data_size + 4;
     buffer = data + data_size;
+    this->datapoints_received_++;
 
     // drop update if datapoint is in ignore_mcu_datapoint_update list
     bool skip = false;
@@ -365,26 +372,24 @@ void Tuya::handle_datapoints_(const uint8_t *buffer, size_t len) {
       continue;
 
     // Update internal datapoints
-    bool found = false;
-    for (auto &other : this->datapoints_) {
-      if (other.id == datapoint.id) {
-        other = datapoint;
-        found = true;
-      }
-    }
-    if (!found) {
-      this->datapoints_.push_back(datapoint);
+    auto stored = std::lower_bound(this->datapoints_.begin(), this->datapoints_.end(), datapoint.id,
+                                   [](const TuyaDatapoint &other, uint8_t id) { return other.id < id; });
+    if (stored != this->datapoints_.end() && stored->id == datapoint.id) {
+      *stored = std::move(datapoint);
+    } else {
+      stored = this->datapoints_.insert(stored, std::move(datapoint));
     }
 
     // Run through listeners
-    for (auto &listener : this->listeners_) {
-      if (listener.datapoint_id == datapoint.id)
-        listener.on_datapoint(datapoint);
-    }
+    auto listener = std::lower_bound(
+        this->listeners_.begin(), this->listeners_.end(), stored->id,
+        [](const TuyaDatapointListener &other, uint8_t id) { return other.datapoint_id < id; });
+    for (; listener != this->listeners_.end() && listener->datapoint_id == stored->id; ++listener)
+      listener->on_datapoint(*stored);
   }
 }
 
-void Tuya::send_raw_command_(TuyaCommand command) {
+void Tuya::send_raw_command_(const TuyaCommand &command) {
   uint8_t len_hi = (uint8_t) (command.payload.size() >> 8);
   uint8_t len_lo = (uint8_t) (command.payload.size() & 0xFF);
   uint8_t version = 0;
@@ -419,6 +424,7 @@ void Tuya::send_raw_command_(TuyaCommand command) {
   for (auto &data : command.payload)
     checksum += data;
   this->write_byte(checksum);
+  this->commands_sent_++;
 }
 
 void Tuya::process_command_queue_() {
@@ -435,26 +441,71 @@ void Tuya::process_command_queue_() {
       if (++this->init_retries_ >= MAX_RETRIES) {
         this->init_failed_ = true;
         ESP_LOGE(TAG, "Initialization failed at init_state %u", static_cast<uint8_t>(this->init_state_));
-        this->command_queue_.erase(command_queue_.begin());
+        this->pop_command_();
         this->init_retries_ = 0;
       }
     } else {
-      this->command_queue_.erase(command_queue_.begin());
+      this->pop_command_();
     }
   }
 
   // Left check of delay since last command in case there's ever a command sent by calling send_raw_command_ directly
-  if (delay > COMMAND_DELAY && !this->command_queue_.empty() && this->rx_message_.empty() &&
+  if (delay > COMMAND_DELAY && this->command_queue_size_ != 0 && this->rx_message_.empty() &&
       !this->expected_response_.has_value()) {
-    this->send_raw_command_(command_queue_.front());
+    this->send_raw_command_(this->queued_command_(0));
     if (!this->expected_response_.has_value())
-      this->command_queue_.erase(command_queue_.begin());
+      this->pop_command_();
   }
 }
 
 void Tuya::send_command_(const TuyaCommand &command) {
-  command_queue_.push_back(command);
-  process_command_queue_();
+  // A write replaces the previous one to the same datapoint only if nothing was queued after it, so the MCU still sees
+  // all writes in order. The first command is still waiting for its response if one is expected.
+  const size_t first_pending = this->expected_response_.has_value() ? 1 : 0;
+  if (command.cmd == TuyaCommandType::DATAPOINT_DELIVER && !command.payload.empty() &&
+      this->command_queue_size_ > first_pending) {
+    TuyaCommand &last = this->queued_command_(this->command_queue_size_ - 1);
+    if (last.cmd == TuyaCommandType::DATAPOINT_DELIVER && !last.payload.empty() &&
+        last.payload[0] == command.payload[0]) {
+      ESP_LOGV(TAG, "Replacing queued write to datapoint %u", command.payload[0]);
+      last.payload = command.payload;
+      this->commands_merged_++;
+      return;
+    }
+  }
+
+  if (this->command_queue_size_ == COMMAND_QUEUE_LENGTH) {
+    ESP_LOGW(TAG, "Command queue is full, dropping command 0x%02X", static_cast<uint8_t>(command.cmd));
+    this->commands_dropped_++;
+    return;
+  }
+  // Assigning keeps the capacity of the payload from the last time the slot was used
+  TuyaCommand &queued = this->queued_command_(this->command_queue_size_++);
+  queued.cmd = command.cmd;
+  queued.payload = command.payload;
+  this->process_command_queue_();
+}
+
+void Tuya::pop_command_() {
+  if (this->command_queue_size_ == 0)
+    return;
+  this->command_queue_head_ = (this->command_queue_head_ + 1) % COMMAND_QUEUE_LENGTH;
+  this->command_queue_size_--;
+}
+
+void Tuya::log_stats_() {
+  if (this->messages_received_ == 0 && this->commands_sent_ == 0 && this->commands_dropped_ == 0)
+    return;
+  ESP_LOGD(TAG,
+           "Received %" PRIu32 " messages with %" PRIu32 " datapoints, sent %" PRIu32 " commands, merged %" PRIu32
+           ", dropped %" PRIu32,
+           this->messages_received_, this->datapoints_received_, this->commands_sent_, this->commands_merged_,
+           this->commands_dropped_);
+  this->messages_received_ = 0;
+  this->datapoints_received_ = 0;
+  this->commands_sent_ = 0;
+  this->commands_merged_ = 0;
+  this->commands_dropped_ = 0;
 }
 
 void Tuya::send_empty_command_(TuyaCommandType command) {
@@ -584,19 +635,19 @@ void Tuya::force_set_bitmask_datapoint_value(uint8_t datapoint_id, uint32_t valu
   this->set_numeric_datapoint_value_(datapoint_id, TuyaDatapointType::BITMASK, value, length, true);
 }
 
-optional<TuyaDatapoint> Tuya::get_datapoint_(uint8_t datapoint_id) {
-  for (auto &datapoint : this->datapoints_) {
-    if (datapoint.id == datapoint_id)
-      return datapoint;
-  }
-  return {};
+const TuyaDatapoint *Tuya::get_datapoint_(uint8_t datapoint_id) const {
+  auto it = std::lower_bound(this->datapoints_.begin(), this->datapoints_.end(), datapoint_id,
+                             [](const TuyaDatapoint &datapoint, uint8_t id) { return datapoint.id < id; });
+  if (it == this->datapoints_.end() || it->id != datapoint_id)
+    return nullptr;
+  return &*it;
 }
 
 void Tuya::set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, const uint32_t value,
                                         uint8_t length, bool forced) {
   ESP_LOGD(TAG, "Setting datapoint %u to %" PRIu32, datapoint_id, value);
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  const TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGW(TAG, "Setting unknown datapoint %u", datapoint_id);
   } else if (datapoint->type != datapoint_type) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
@@ -625,8 +676,8 @@ void Tuya::set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType
 
 void Tuya::set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint8_t> &value, bool forced) {
   ESP_LOGD(TAG, "Setting datapoint %u to %s", datapoint_id, format_hex_pretty(value).c_str());
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  const TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGW(TAG, "Setting unknown datapoint %u", datapoint_id);
   } else if (datapoint->type != TuyaDatapointType::RAW) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
@@ -640,8 +691,8 @@ void Tuya::set_raw_datapoint_value_(uint8_t datapoint_id, const std::vector<uint
 
 void Tuya::set_string_datapoint_value_(uint8_t datapoint_id, const std::string &value, bool forced) {
   ESP_LOGD(TAG, "Setting datapoint %u to %s", datapoint_id, value.c_str());
-  optional<TuyaDatapoint> datapoint = this->get_datapoint_(datapoint_id);
-  if (!datapoint.has_value()) {
+  const TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint == nullptr) {
     ESP_LOGW(TAG, "Setting unknown datapoint %u", datapoint_id);
   } else if (datapoint->type != TuyaDatapointType::STRING) {
     ESP_LOGE(TAG, "Attempt to set datapoint %u with incorrect type", datapoint_id);
@@ -673,13 +724,16 @@ void Tuya::register_listener(uint8_t datapoint_id, const std::function<void(Tuya
       .datapoint_id = datapoint_id,
       .on_datapoint = func,
   };
-  this->listeners_.push_back(listener);
+  // After the listeners already registered for this datapoint
+  auto position = std::upper_bound(
+      this->listeners_.begin(), this->listeners_.end(), datapoint_id,
+      [](uint8_t id, const TuyaDatapointListener &other) { return id < other.datapoint_id; });
+  this->listeners_.insert(position, listener);
 
   // Run through existing datapoints
-  for (auto &datapoint : this->datapoints_) {
-    if (datapoint.id == datapoint_id)
-      func(datapoint);
-  }
+  const TuyaDatapoint *datapoint = this->get_datapoint_(datapoint_id);
+  if (datapoint != nullptr)
+    func(*datapoint);
 }
 
 TuyaInitState Tuya::get_init_state() { return this->init_state_; }
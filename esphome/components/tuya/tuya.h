@@ -110,13 +110,20 @@ class Tuya : public Component, public uart::UARTDevice {
  protected:
   void handle_char_(uint8_t c);
   void handle_datapoints_(const uint8_t *buffer, size_t len);
-  optional<TuyaDatapoint> get_datapoint_(uint8_t datapoint_id);
+  /// The last reported value of a datapoint, or nullptr if the MCU hasn't reported it yet.
+  const TuyaDatapoint *get_datapoint_(uint8_t datapoint_id) const;
   bool validate_message_();
 
   void handle_command_(uint8_t command, uint8_t version, const uint8_t *buffer, size_t len);
-  void send_raw_command_(TuyaCommand command);
+  void send_raw_command_(const TuyaCommand &command);
   void process_command_queue_();
+  /// Queue a command. A datapoint write replaces a queued write to the same datapoint that hasn't been sent yet.
   void send_command_(const TuyaCommand &command);
+  TuyaCommand &queued_command_(size_t index) {
+    return this->command_queue_[(this->command_queue_head_ + index) % COMMAND_QUEUE_LENGTH];
+  }
+  void pop_command_();
+  void log_stats_();
   void send_empty_command_(TuyaCommandType command);
   void set_numeric_datapoint_value_(uint8_t datapoint_id, TuyaDatapointType datapoint_type, uint32_t value,
                                     uint8_t length, bool forced);
@@ -143,11 +150,21 @@ class Tuya : public Component, public uart::UARTDevice {
   uint32_t last_command_timestamp_ = 0;
   uint32_t last_rx_char_timestamp_ = 0;
   std::string product_ = "";
+  /// Sorted by datapoint id, listeners of the same datapoint in the order they registered.
   std::vector<TuyaDatapointListener> listeners_;
+  /// Sorted by datapoint id.
   std::vector<TuyaDatapoint> datapoints_;
   std::vector<uint8_t> rx_message_;
   std::vector<uint8_t> ignore_mcu_update_on_datapoints_{};
-  std::vector<TuyaCommand> command_queue_;
+  static const size_t COMMAND_QUEUE_LENGTH = 16;
+  TuyaCommand command_queue_[COMMAND_QUEUE_LENGTH];
+  size_t command_queue_head_{0};
+  size_t command_queue_size_{0};
+  uint32_t messages_received_{0};
+  uint32_t datapoints_received_{0};
+  uint32_t commands_sent_{0};
+  uint32_t commands_merged_{0};
+  uint32_t commands_dropped_{0};
   optional<TuyaCommandType> expected_response_{};
   uint8_t wifi_status_ = -1;
   CallbackManager<void()> initialized_callback_{};
@@ -13,6 +13,7 @@ from esphome.const import (
     CONF_TX_PIN,
     CONF_UART_ID,
     CONF_DATA,
+    CONF_DEVICE,
     CONF_RX_BUFFER_SIZE,
     CONF_INVERTED,
     CONF_INVERT,
@@ -45,6 +46,7 @@ RP2040UartComponent = uart_ns.class_("RP2040UartComponent", UARTComponent, cg.Co
 LibreTinyUARTComponent = uart_ns.class_(
     "LibreTinyUARTComponent", UARTComponent, cg.Component
 )
+HostUartComponent = uart_ns.class_("HostUartComponent", UARTComponent, cg.Component)
 
 UARTDevice = uart_ns.class_("UARTDevice")
 UARTWriteAction = uart_ns.class_("UARTWriteAction", automation.Action)
@@ -97,9 +99,24 @@ def _uart_declare_type(value):
         return cv.declare_id(RP2040UartComponent)(value)
     if CORE.is_libretiny:
         return cv.declare_id(LibreTinyUARTComponent)(value)
+    if CORE.is_host:
+        return cv.declare_id(HostUartComponent)(value)
     raise NotImplementedError
 
 
+def validate_host_device(config):
+    if CORE.is_host:
+        if CONF_DEVICE not in config:
+            raise cv.Invalid("A serial device is required on the host platform")
+        return config
+    if CONF_DEVICE in config:
+        raise cv.Invalid(
+            "The device option is only available on the host platform",
+            path=[CONF_DEVICE],
+        )
+    return cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN)(config)
+
+
 UARTParityOptions = uart_ns.enum("UARTParityOptions")
 UART_PARITY_OPTIONS = {
     "NONE": UARTParityOptions.UART_CONFIG_PARITY_NONE,
@@ -181,9 +198,10 @@ CONFIG_SCHEMA = cv.All(
                 "This option has been removed. Please instead use invert in the tx/rx pin schemas."
             ),
             cv.Optional(CONF_DEBUG): maybe_empty_debug,
+            cv.Optional(CONF_DEVICE): cv.string,
         }
     ).extend(cv.COMPONENT_SCHEMA),
-    cv.has_at_least_one_key(CONF_TX_PIN, CONF_RX_PIN),
+    validate_host_device,
     validate_invert_esp32,
 )
 
@@ -226,6 +244,8 @@ async def to_code(config):
     if CONF_RX_PIN in config:
         rx_pin = await cg.gpio_pin_expression(config[CONF_RX_PIN])
         cg.add(var.set_rx_pin(rx_pin))
+    if CONF_DEVICE in config:
+        cg.add(var.set_device(config[CONF_DEVICE]))
     cg.add(var.set_rx_buffer_size(config[CONF_RX_BUFFER_SIZE]))
     cg.add(var.set_stop_bits(config[CONF_STOP_BITS]))
     cg.add(var.set_data_bits(config[CONF_DATA_BITS]))
@@ -40,6 +40,13 @@ class UARTDevice {
 
   int available() { return this->parent_->available(); }
 
+  size_t peek_span(const uint8_t **data) { return this->parent_->peek_span(data); }
+  void consume(size_t len) { this->parent_->consume(len); }
+  size_t buffered() { return this->parent_->buffered(); }
+  size_t read_until(uint8_t delimiter, uint8_t *data, size_t max_len) {
+    return this->parent_->read_until(delimiter, data, max_len);
+  }
+
   void flush() { return this->parent_->flush(); }
 
   // Compat APIs
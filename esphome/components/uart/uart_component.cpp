@@ -1,9 +1,14 @@
 #include "uart_component.h"
+#include "esphome/core/helpers.h"
+
+#include <algorithm>
 
 namespace esphome {
 namespace uart {
 
 static const char *const TAG = "uart";
+// The driver already buffers rx_buffer_size bytes, the ring only has to hold what a parser looks at in one go
+static const size_t MAX_RING_SIZE = 256;
 
 bool UARTComponent::check_read_timeout_(size_t len) {
   if (this->available() >= int(len))
@@ -20,5 +25,85 @@ bool UARTComponent::check_read_timeout_(size_t len) {
   return true;
 }
 
+void UARTComponent::fill_ring_() {
+  if (this->ring_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    const size_t size = std::min(this->rx_buffer_size_, MAX_RING_SIZE);
+    this->ring_ = allocator.allocate(size);
+    if (this->ring_ == nullptr) {
+      ESP_LOGE(TAG, "Could not allocate receive buffer");
+      return;
+    }
+    this->ring_size_ = size;
+  }
+
+  int available = this->available();
+  if (available <= 0)
+    return;
+
+  // At most two reads, one up to the end of the ring and one after wrapping around
+  while (available > 0 && this->ring_count_ < this->ring_size_) {
+    const size_t tail = (this->ring_head_ + this->ring_count_) % this->ring_size_;
+    const size_t len = std::min({size_t(available), this->ring_size_ - this->ring_count_, this->ring_size_ - tail});
+    if (!this->read_array(this->ring_ + tail, len))
+      break;
+    this->ring_count_ += len;
+    available -= len;
+  }
+}
+
+size_t UARTComponent::peek_span(const uint8_t **data) {
+  this->fill_ring_();
+  if (this->ring_count_ == 0)
+    return 0;
+  *data = this->ring_ + this->ring_head_;
+  return std::min(this->ring_count_, this->ring_size_ - this->ring_head_);
+}
+
+void UARTComponent::consume(size_t len) {
+  len = std::min(len, this->ring_count_);
+  this->ring_count_ -= len;
+  this->ring_head_ = this->ring_count_ == 0 ? 0 : (this->ring_head_ + len) % this->ring_size_;
+}
+
+size_t UARTComponent::buffered() {
+  this->fill_ring_();
+  return this->ring_count_;
+}
+
+size_t UARTComponent::read_until(uint8_t delimiter, uint8_t *data, size_t max_len) {
+  this->fill_ring_();
+
+  // The buffered bytes are at most two contiguous regions
+  size_t offset = 0;
+  while (offset < this->ring_count_) {
+    const size_t start = (this->ring_head_ + offset) % this->ring_size_;
+    const size_t len = std::min(this->ring_count_ - offset, this->ring_size_ - start);
+    const auto *found = static_cast<const uint8_t *>(memchr(this->ring_ + start, delimiter, len));
+    if (found == nullptr) {
+      offset += len;
+      continue;
+    }
+
+    const size_t frame_len = offset + (found - (this->ring_ + start)) + 1;
+    if (frame_len > max_len) {
+      ESP_LOGW(TAG, "Dropping frame of %zu bytes, longer than %zu bytes", frame_len, max_len);
+      this->consume(frame_len);
+      return 0;
+    }
+    const size_t first = std::min(frame_len, this->ring_size_ - this->ring_head_);
+    memcpy(data, this->ring_ + this->ring_head_, first);
+    memcpy(data + first, this->ring_, frame_len - first);
+    this->consume(frame_len);
+    return frame_len;
+  }
+
+  if (this->ring_count_ == this->ring_size_) {
+    ESP_LOGW(TAG, "Receive buffer full without delimiter, dropping %zu bytes", this->ring_count_);
+    this->consume(this->ring_count_);
+  }
+  return 0;
+}
+
 }  // namespace uart
 }  // namespace esphome
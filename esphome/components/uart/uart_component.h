@@ -49,6 +49,29 @@ class UARTComponent {
   /// Block until all bytes have been written to the UART bus.
   virtual void flush() = 0;
 
+  /** Zero-copy access to received bytes.
+   *
+   * Pending bytes are pulled from the driver in bulk into a small ring buffer of at most 256 bytes; whatever doesn't
+   * fit stays in the driver's own rx_buffer_size buffer until the ring has room again. The returned span is
+   * the longest contiguous run of buffered bytes, which stays valid until the next call to consume() or to any of
+   * these methods. Bytes moved into the ring are no longer seen by available() and read_array(), so a device should
+   * stick to one of the two ways of reading.
+   *
+   * @param data Set to the start of the span.
+   * @return The length of the span, 0 if nothing has been received.
+   */
+  size_t peek_span(const uint8_t **data);
+  /// Drop len bytes from the start of the received data, after processing them from peek_span().
+  void consume(size_t len);
+  /// Number of received bytes that are buffered in the ring.
+  size_t buffered();
+  /** Read one frame ending with delimiter (included) into data.
+   *
+   * @return The length of the frame, or 0 if no complete frame has been received yet. Frames longer than max_len or
+   * than the ring buffer are dropped.
+   */
+  size_t read_until(uint8_t delimiter, uint8_t *data, size_t max_len);
+
   void set_tx_pin(InternalGPIOPin *tx_pin) { this->tx_pin_ = tx_pin; }
   void set_rx_pin(InternalGPIOPin *rx_pin) { this->rx_pin_ = rx_pin; }
   void set_rx_buffer_size(size_t rx_buffer_size) { this->rx_buffer_size_ = rx_buffer_size; }
@@ -72,6 +95,8 @@ class UARTComponent {
  protected:
   virtual void check_logger_conflict() = 0;
   bool check_read_timeout_(size_t len = 1);
+  /// Move pending bytes from the driver into the ring buffer.
+  void fill_ring_();
 
   InternalGPIOPin *tx_pin_;
   InternalGPIOPin *rx_pin_;
@@ -80,6 +105,10 @@ class UARTComponent {
   uint8_t stop_bits_;
   uint8_t data_bits_;
   UARTParityOptions parity_;
+  uint8_t *ring_{nullptr};
+  size_t ring_size_{0};
+  size_t ring_head_{0};
+  size_t ring_count_{0};
 #ifdef USE_UART_DEBUGGER
   CallbackManager<void(UARTDirection, uint8_t)> debug_callback_{};
 #endif
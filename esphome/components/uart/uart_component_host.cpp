@@ -0,0 +1,191 @@
+#ifdef USE_HOST
+#include "uart_component_host.h"
+#include "esphome/core/log.h"
+
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <termios.h>
+#include <unistd.h>
+
+namespace esphome {
+namespace uart {
+
+static const char *const TAG = "uart.host";
+
+static speed_t baud_rate_to_speed(uint32_t baud_rate) {
+  switch (baud_rate) {
+    case 1200:
+      return B1200;
+    case 2400:
+      return B2400;
+    case 4800:
+      return B4800;
+    case 9600:
+      return B9600;
+    case 19200:
+      return B19200;
+    case 38400:
+      return B38400;
+    case 57600:
+      return B57600;
+    case 115200:
+      return B115200;
+    case 230400:
+      return B230400;
+#ifdef B460800
+    case 460800:
+      return B460800;
+#endif
+#ifdef B921600
+    case 921600:
+      return B921600;
+#endif
+#ifdef B2000000
+    case 2000000:
+      return B2000000;
+#endif
+    default:
+      return B0;
+  }
+}
+
+void HostUartComponent::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up UART bus...");
+
+  this->fd_ = ::open(this->device_.c_str(), O_RDWR | O_NOCTTY | O_NONBLOCK);
+  if (this->fd_ < 0) {
+    ESP_LOGE(TAG, "Could not open %s: %s", this->device_.c_str(), strerror(errno));
+    this->mark_failed();
+    return;
+  }
+
+  // Pseudo terminals ignore the line settings, but real serial devices need them
+  struct termios tty;
+  if (tcgetattr(this->fd_, &tty) != 0)
+    return;
+  cfmakeraw(&tty);
+  tty.c_cflag |= CLOCAL | CREAD;
+  tty.c_cflag &= ~(CSIZE | CSTOPB | PARENB | PARODD);
+  switch (this->data_bits_) {
+    case 5:
+      tty.c_cflag |= CS5;
+      break;
+    case 6:
+      tty.c_cflag |= CS6;
+      break;
+    case 7:
+      tty.c_cflag |= CS7;
+      break;
+    default:
+      tty.c_cflag |= CS8;
+      break;
+  }
+  if (this->stop_bits_ == 2)
+    tty.c_cflag |= CSTOPB;
+  if (this->parity_ == UART_CONFIG_PARITY_EVEN) {
+    tty.c_cflag |= PARENB;
+  } else if (this->parity_ == UART_CONFIG_PARITY_ODD) {
+    tty.c_cflag |= PARENB | PARODD;
+  }
+  const speed_t speed = baud_rate_to_speed(this->baud_rate_);
+  if (speed != B0) {
+    cfsetispeed(&tty, speed);
+    cfsetospeed(&tty, speed);
+  } else {
+    ESP_LOGW(TAG, "Baud rate %u is not supported, keeping the current one", this->baud_rate_);
+  }
+  if (tcsetattr(this->fd_, TCSANOW, &tty) != 0)
+    ESP_LOGW(TAG, "Could not configure %s: %s", this->device_.c_str(), strerror(errno));
+}
+
+void HostUartComponent::dump_config() {
+  ESP_LOGCONFIG(TAG, "UART Bus:");
+  ESP_LOGCONFIG(TAG, "  Device: %s", this->device_.c_str());
+  ESP_LOGCONFIG(TAG, "  RX Buffer Size: %zu", this->rx_buffer_size_);
+  ESP_LOGCONFIG(TAG, "  Baud Rate: %u baud", this->baud_rate_);
+  ESP_LOGCONFIG(TAG, "  Data Bits: %u", this->data_bits_);
+  ESP_LOGCONFIG(TAG, "  Parity: %s", LOG_STR_ARG(parity_to_str(this->parity_)));
+  ESP_LOGCONFIG(TAG, "  Stop bits: %u", this->stop_bits_);
+}
+
+void HostUartComponent::write_array(const uint8_t *data, size_t len) {
+  if (this->fd_ < 0)
+    return;
+  while (len > 0) {
+    ssize_t written = ::write(this->fd_, data, len);
+    if (written < 0) {
+      if (errno == EAGAIN || errno == EINTR) {
+        yield();
+        continue;
+      }
+      ESP_LOGW(TAG, "Write failed: %s", strerror(errno));
+      return;
+    }
+#ifdef USE_UART_DEBUGGER
+    for (ssize_t i = 0; i < written; i++) {
+      this->debug_callback_.call(UART_DIRECTION_TX, data[i]);
+    }
+#endif
+    data += written;
+    len -= written;
+  }
+}
+
+bool HostUartComponent::peek_byte(uint8_t *data) {
+  if (!this->has_peek_) {
+    if (!this->check_read_timeout_())
+      return false;
+    if (::read(this->fd_, &this->peek_buffer_, 1) != 1)
+      return false;
+    this->has_peek_ = true;
+  }
+  *data = this->peek_buffer_;
+  return true;
+}
+
+bool HostUartComponent::read_array(uint8_t *data, size_t len) {
+  if (!this->check_read_timeout_(len))
+    return false;
+
+  uint8_t *out = data;
+  if (this->has_peek_ && len > 0) {
+    *out++ = this->peek_buffer_;
+    this->has_peek_ = false;
+  }
+  while (out != data + len) {
+    ssize_t received = ::read(this->fd_, out, data + len - out);
+    if (received < 0 && (errno == EAGAIN || errno == EINTR))
+      continue;
+    if (received <= 0)
+      return false;
+    out += received;
+  }
+#ifdef USE_UART_DEBUGGER
+  for (size_t i = 0; i < len; i++) {
+    this->debug_callback_.call(UART_DIRECTION_RX, data[i]);
+  }
+#endif
+  return true;
+}
+
+int HostUartComponent::available() {
+  if (this->fd_ < 0)
+    return 0;
+  int available = 0;
+  if (ioctl(this->fd_, FIONREAD, &available) != 0)
+    available = 0;
+  return available + this->has_peek_;
+}
+
+void HostUartComponent::flush() {
+  ESP_LOGVV(TAG, "    Flushing...");
+  if (this->fd_ >= 0)
+    tcdrain(this->fd_);
+}
+
+}  // namespace uart
+}  // namespace esphome
+
+#endif  // USE_HOST
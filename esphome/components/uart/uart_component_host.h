@@ -0,0 +1,43 @@
+#pragma once
+
+#ifdef USE_HOST
+
+#include <string>
+#include "esphome/core/component.h"
+#include "esphome/core/hal.h"
+#include "esphome/core/log.h"
+#include "uart_component.h"
+
+namespace esphome {
+namespace uart {
+
+/// UART bus on a serial device of the host, e.g. a USB adapter or one end of a pseudo terminal pair.
+class HostUartComponent : public UARTComponent, public Component {
+ public:
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override { return setup_priority::BUS; }
+
+  void set_device(const std::string &device) { this->device_ = device; }
+
+  void write_array(const uint8_t *data, size_t len) override;
+
+  bool peek_byte(uint8_t *data) override;
+  bool read_array(uint8_t *data, size_t len) override;
+
+  int available() override;
+  void flush() override;
+
+ protected:
+  void check_logger_conflict() override {}
+
+  std::string device_;
+  int fd_{-1};
+  bool has_peek_{false};
+  uint8_t peek_buffer_;
+};
+
+}  // namespace uart
+}  // namespace esphome
+
+#endif  // USE_HOST
@@ -1,5 +1,6 @@
 #include "waveshare_epaper.h"
 #include "esphome/core/log.h"
+#include "esphome/core/hal.h"
 #include "esphome/core/application.h"
 #include "esphome/core/helpers.h"
 #include <cinttypes>
@@ -126,7 +127,9 @@ bool WaveshareEPaper::wait_until_idle_() {
 }
 void WaveshareEPaper::update() {
   this->do_update_();
+  const uint32_t flush_start = micros();
   this->display();
+  this->record_flush_time_(flush_start);
 }
 void WaveshareEPaper::fill(Color color) {
   // flip logic
@@ -257,37 +260,107 @@ void WaveshareEPaperTypeA::dump_config() {
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
   LOG_UPDATE_INTERVAL(this);
 }
-void HOT WaveshareEPaperTypeA::display() {
-  bool full_update = this->at_update_ == 0;
-  bool prev_full_update = this->at_update_ == 1;
+bool WaveshareEPaperTypeA::update_changed_window_() {
+  const uint32_t stride = this->get_width_controller() / 8u;
+  const uint32_t rows = this->get_height_internal();
+
+  uint32_t x_start = stride;
+  uint32_t x_end = 0;
+  uint32_t y_start = rows;
+  uint32_t y_end = 0;
+  for (uint32_t y = 0; y < rows; y++) {
+    const uint8_t *row = this->buffer_ + y * stride;
+    const uint8_t *shadow_row = this->shadow_buffer_ + y * stride;
+    if (memcmp(row, shadow_row, stride) == 0)
+      continue;
+    uint32_t first = 0;
+    while (row[first] == shadow_row[first])
+      first++;
+    uint32_t last = stride - 1;
+    while (row[last] == shadow_row[last])
+      last--;
+    x_start = std::min(x_start, first);
+    x_end = std::max(x_end, last);
+    y_start = std::min(y_start, y);
+    y_end = std::max(y_end, y);
+  }
 
-  if (!this->wait_until_idle_()) {
-    this->status_set_warning();
-    return;
+  // The controller alternates between two RAM banks, so the bank written now still misses the changes of the
+  // previous update as well
+  uint32_t window_x_start = x_start;
+  uint32_t window_x_end = x_end;
+  uint32_t window_y_start = y_start;
+  uint32_t window_y_end = y_end;
+  if (this->prev_window_x_start_ <= this->prev_window_x_end_) {
+    window_x_start = std::min<uint32_t>(window_x_start, this->prev_window_x_start_);
+    window_x_end = std::max<uint32_t>(window_x_end, this->prev_window_x_end_);
+    window_y_start = std::min<uint32_t>(window_y_start, this->prev_window_y_start_);
+    window_y_end = std::max<uint32_t>(window_y_end, this->prev_window_y_end_);
   }
 
-  if (this->full_update_every_ >= 1) {
-    if (full_update != prev_full_update) {
-      switch (this->model_) {
-        case TTGO_EPAPER_2_13_IN:
-          this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO : PARTIAL_UPDATE_LUT_TTGO, LUT_SIZE_TTGO);
-          break;
-        case TTGO_EPAPER_2_13_IN_B73:
-          this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO_B73 : PARTIAL_UPDATE_LUT_TTGO_B73, LUT_SIZE_TTGO_B73);
-          break;
-        case TTGO_EPAPER_2_13_IN_B74:
-          // there is no LUT
-          break;
-        case TTGO_EPAPER_2_13_IN_B1:
-          this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO_B1 : PARTIAL_UPDATE_LUT_TTGO_B1, LUT_SIZE_TTGO_B1);
-          break;
-        default:
-          this->write_lut_(full_update ? FULL_UPDATE_LUT : PARTIAL_UPDATE_LUT, LUT_SIZE_WAVESHARE);
-      }
-    }
-    this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
+  this->prev_window_x_start_ = x_start;
+  this->prev_window_x_end_ = x_end;
+  this->prev_window_y_start_ = y_start;
+  this->prev_window_y_end_ = y_end;
+  if (window_y_start > window_y_end)
+    return false;
+
+  this->window_x_start_ = window_x_start;
+  this->window_x_end_ = window_x_end;
+  this->window_y_start_ = window_y_start;
+  this->window_y_end_ = window_y_end;
+  return true;
+}
+void WaveshareEPaperTypeA::write_border_waveform_(bool full_update) {
+  if (this->model_ != TTGO_EPAPER_2_13_IN_B74)
+    return;
+  // BorderWaveform
+  this->command(0x3C);
+  this->data(full_update ? 0x05 : 0x80);
+}
+bool WaveshareEPaperTypeA::write_window_() {
+  const uint32_t stride = this->get_width_controller() / 8u;
+  const uint32_t len = this->window_x_end_ - this->window_x_start_ + 1;
+
+  this->write_border_waveform_(false);
+
+  // COMMAND SET RAM X ADDRESS START END POSITION
+  this->command(0x44);
+  this->data(this->window_x_start_);
+  this->data(this->window_x_end_);
+  // COMMAND SET RAM Y ADDRESS START END POSITION
+  this->command(0x45);
+  this->data(this->window_y_start_);
+  this->data(this->window_y_start_ >> 8);
+  this->data(this->window_y_end_);
+  this->data(this->window_y_end_ >> 8);
+
+  // COMMAND SET RAM X ADDRESS COUNTER
+  this->command(0x4E);
+  this->data(this->window_x_start_);
+  // COMMAND SET RAM Y ADDRESS COUNTER
+  this->command(0x4F);
+  this->data(this->window_y_start_);
+  this->data(this->window_y_start_ >> 8);
+
+  if (!this->wait_until_idle_())
+    return false;
+
+  // COMMAND WRITE RAM
+  this->command(0x24);
+  this->start_data_();
+  for (uint32_t y = this->window_y_start_; y <= this->window_y_end_; y++) {
+    const uint32_t pos = y * stride + this->window_x_start_;
+    this->write_array(this->buffer_ + pos, len);
+    memcpy(this->shadow_buffer_ + pos, this->buffer_ + pos, len);
   }
+  this->end_data_();
 
+  ESP_LOGV(TAG, "Partial update of bytes %u-%u, rows %u-%u", this->window_x_start_, this->window_x_end_,
+           this->window_y_start_, this->window_y_end_);
+  return true;
+}
+bool WaveshareEPaperTypeA::write_full_frame_(bool full_update) {
   // Set x & y regions we want to write to (full)
   switch (this->model_) {
     case TTGO_EPAPER_2_13_IN_B1:
@@ -312,9 +385,7 @@ void HOT WaveshareEPaperTypeA::display() {
 
       break;
     case TTGO_EPAPER_2_13_IN_B74:
-      // BorderWaveform
-      this->command(0x3C);
-      this->data(full_update ? 0x05 : 0x80);
+      this->write_border_waveform_(full_update);
 
       // fall through
     default:
@@ -338,10 +409,8 @@ void HOT WaveshareEPaperTypeA::display() {
       this->data(0x00);
   }
 
-  if (!this->wait_until_idle_()) {
-    this->status_set_warning();
-    return;
-  }
+  if (!this->wait_until_idle_())
+    return false;
 
   // COMMAND WRITE RAM
   this->command(0x24);
@@ -362,6 +431,73 @@ void HOT WaveshareEPaperTypeA::display() {
   }
   this->end_data_();
 
+  if (this->shadow_buffer_ != nullptr) {
+    memcpy(this->shadow_buffer_, this->buffer_, this->get_buffer_length_());
+    // The other RAM bank may still hold an older frame, so the first partial update resends everything
+    this->prev_window_x_start_ = 0;
+    this->prev_window_x_end_ = this->get_width_controller() / 8u - 1;
+    this->prev_window_y_start_ = 0;
+    this->prev_window_y_end_ = this->get_height_internal() - 1;
+  }
+  return true;
+}
+void HOT WaveshareEPaperTypeA::display() {
+  bool full_update = this->at_update_ == 0;
+  bool prev_full_update = this->at_update_ == 1;
+
+  // Partial updates only send the window that changed since the last frame. The B1 panel is written
+  // bottom-up and always gets the whole frame.
+  bool partial_window = !full_update && this->full_update_every_ > 1 && this->model_ != TTGO_EPAPER_2_13_IN_B1;
+  if (partial_window && this->shadow_buffer_ == nullptr) {
+    ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+    this->shadow_buffer_ = allocator.allocate(this->get_buffer_length_());
+    // Without a shadow buffer this is a partial update of the whole frame, and the allocation is retried next time.
+    // Otherwise the content of the controller RAM is unknown, so everything is sent once as well.
+    if (this->shadow_buffer_ == nullptr)
+      ESP_LOGW(TAG, "Could not allocate shadow buffer, sending the whole frame");
+    partial_window = false;
+  }
+  if (partial_window && !this->update_changed_window_()) {
+    ESP_LOGV(TAG, "Nothing changed, skipping update");
+    // A skipped frame still counts towards full_update_every. The partial LUT is already loaded, since the
+    // first partial update after a full refresh always resends the whole frame and is never skipped.
+    this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
+    return;
+  }
+
+  if (!this->wait_until_idle_()) {
+    this->status_set_warning();
+    return;
+  }
+
+  if (this->full_update_every_ >= 1) {
+    if (full_update != prev_full_update) {
+      switch (this->model_) {
+        case TTGO_EPAPER_2_13_IN:
+          this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO : PARTIAL_UPDATE_LUT_TTGO, LUT_SIZE_TTGO);
+          break;
+        case TTGO_EPAPER_2_13_IN_B73:
+          this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO_B73 : PARTIAL_UPDATE_LUT_TTGO_B73, LUT_SIZE_TTGO_B73);
+          break;
+        case TTGO_EPAPER_2_13_IN_B74:
+          // there is no LUT
+          break;
+        case TTGO_EPAPER_2_13_IN_B1:
+          this->write_lut_(full_update ? FULL_UPDATE_LUT_TTGO_B1 : PARTIAL_UPDATE_LUT_TTGO_B1, LUT_SIZE_TTGO_B1);
+          break;
+        default:
+          this->write_lut_(full_update ? FULL_UPDATE_LUT : PARTIAL_UPDATE_LUT, LUT_SIZE_WAVESHARE);
+      }
+    }
+    this->at_update_ = (this->at_update_ + 1) % this->full_update_every_;
+  }
+
+  bool written = partial_window ? this->write_window_() : this->write_full_frame_(full_update);
+  if (!written) {
+    this->status_set_warning();
+    return;
+  }
+
   // COMMAND DISPLAY UPDATE CONTROL 2
   this->command(0x22);
   switch (this->model_) {
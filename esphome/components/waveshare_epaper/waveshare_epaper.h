@@ -109,6 +109,18 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
  protected:
   void write_lut_(const uint8_t *lut, uint8_t size);
 
+  /** Compare the buffer against the last sent frame and set the pending window to cover every changed byte.
+   *
+   * @return false if there is nothing to send.
+   */
+  bool update_changed_window_();
+  /// Send the whole buffer to the controller RAM.
+  bool write_full_frame_(bool full_update);
+  /// Set the border waveform on panels that need it, for both full frames and windows.
+  void write_border_waveform_(bool full_update);
+  /// Send the pending window of the buffer to the controller RAM.
+  bool write_window_();
+
   int get_width_internal() override;
 
   int get_height_internal() override;
@@ -119,6 +131,19 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
   uint32_t at_update_{0};
   WaveshareEPaperTypeAModel model_;
   uint32_t idle_timeout_() override;
+
+  /// Copy of the last frame sent to the controller, only used for partial updates.
+  uint8_t *shadow_buffer_{nullptr};
+  /// Pending window, in bytes (x) and rows (y), inclusive. Empty when x_end < x_start.
+  uint16_t window_x_start_{0};
+  uint16_t window_x_end_{0};
+  uint16_t window_y_start_{0};
+  uint16_t window_y_end_{0};
+  /// Bytes changed by the previous update; the controller alternates RAM banks so they are sent again.
+  uint16_t prev_window_x_start_{1};
+  uint16_t prev_window_x_end_{0};
+  uint16_t prev_window_y_start_{0};
+  uint16_t prev_window_y_end_{0};
 };
 
 enum WaveshareEPaperTypeBModel {
@@ -4,10 +4,15 @@ from esphome.components.light.types import AddressableLightEffect
 from esphome.components.light.effects import register_addressable_effect
 from esphome.const import CONF_NAME, CONF_PORT
 
+AUTO_LOAD = ["socket"]
+DEPENDENCIES = ["network"]
+
+CONF_JITTER_BUFFER = "jitter_buffer"
+
 wled_ns = cg.esphome_ns.namespace("wled")
 WLEDLightEffect = wled_ns.class_("WLEDLightEffect", AddressableLightEffect)
 
-CONFIG_SCHEMA = cv.All(cv.Schema({}), cv.only_with_arduino)
+CONFIG_SCHEMA = cv.Schema({})
 
 
 @register_addressable_effect(
@@ -16,10 +21,14 @@ CONFIG_SCHEMA = cv.All(cv.Schema({}), cv.only_with_arduino)
     "WLED",
     {
         cv.Optional(CONF_PORT, default=21324): cv.port,
+        cv.Optional(
+            CONF_JITTER_BUFFER, default="0ms"
+        ): cv.positive_time_period_milliseconds,
     },
 )
 async def wled_light_effect_to_code(config, effect_id):
     effect = cg.new_Pvariable(effect_id, config[CONF_NAME])
     cg.add(effect.set_port(config[CONF_PORT]))
+    cg.add(effect.set_jitter_buffer(config[CONF_JITTER_BUFFER]))
 
     return effect
@@ -1,9 +1,10 @@
-#ifdef USE_ARDUINO
-
 #include "wled_light_effect.h"
 #include "esphome/core/log.h"
 #include "esphome/core/helpers.h"
 
+#include <cstring>
+
+#ifdef USE_ARDUINO
 #ifdef USE_ESP32
 #include <WiFi.h>
 #endif
@@ -12,6 +13,7 @@
 #include <ESP8266WiFi.h>
 #include <WiFiUdp.h>
 #endif
+#endif
 
 namespace esphome {
 namespace wled {
@@ -20,8 +22,33 @@ namespace wled {
 // https://github.com/Aircoookie/WLED/wiki/UDP-Realtime-Control
 enum Protocol { WLED_NOTIFIER = 0, WARLS = 1, DRGB = 2, DRGBW = 3, DNRGB = 4 };
 
+// Distributed Display Protocol:
+// http://www.3waylabs.com/ddp/
+static const uint8_t DDP_VERSION_MASK = 0xC0;
+static const uint8_t DDP_VERSION_1 = 0x40;
+static const uint8_t DDP_FLAG_TIMECODE = 0x10;
+static const uint8_t DDP_FLAG_QUERY = 0x02;
+static const uint8_t DDP_FLAG_PUSH = 0x01;
+static const uint8_t DDP_TYPE_RGB = 0x0B;
+static const uint8_t DDP_TYPE_RGBW = 0x1B;
+static const uint8_t DDP_ID_DISPLAY = 1;
+static const uint16_t DDP_HEADER_SIZE = 10;
+static const uint16_t DDP_TIMECODE_SIZE = 4;
+
 const int DEFAULT_BLANK_TIME = 1000;
 
+// Largest datagram that fits into a single Ethernet frame
+static const uint16_t MAX_PACKET_SIZE = 1472;
+// The jitter buffer holds this many frames of the light's size, in at most this many datagrams
+static const uint8_t JITTER_BUFFER_FRAMES = 4;
+static const uint8_t JITTER_BUFFER_SLOTS = 64;
+// Gaps between frames longer than this are pauses of the sender and don't count towards the frame rate
+static const uint32_t MAX_FRAME_INTERVAL = 1000;
+
+static bool is_ddp(const uint8_t *payload, uint16_t size) {
+  return size >= DDP_HEADER_SIZE && (payload[0] & DDP_VERSION_MASK) == DDP_VERSION_1;
+}
+
 static const char *const TAG = "wled_light_effect";
 
 WLEDLightEffect::WLEDLightEffect(const std::string &name) : AddressableLightEffect(name) {}
@@ -30,15 +57,28 @@ void WLEDLightEffect::start() {
   AddressableLightEffect::start();
 
   blank_at_ = 0;
+  slot_head_ = 0;
+  slot_count_ = 0;
+  frames_queued_ = 0;
+  bypass_frame_ = false;
+  frame_interval_ = 0;
+  last_frame_received_ = 0;
 }
 
 void WLEDLightEffect::stop() {
   AddressableLightEffect::stop();
 
+#ifdef USE_ARDUINO
   if (udp_) {
     udp_->stop();
     udp_.reset();
   }
+#else
+  if (this->socket_) {
+    this->socket_->close();
+    this->socket_.reset();
+  }
+#endif
 }
 
 void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) {
@@ -50,33 +90,238 @@ void WLEDLightEffect::blank_all_leds_(light::AddressableLight &it) {
 
 void WLEDLightEffect::apply(light::AddressableLight &it, const Color &current_color) {
   // Init UDP lazily
-  if (!udp_) {
-    udp_ = make_unique<WiFiUDP>();
-
-    if (!udp_->begin(port_)) {
-      ESP_LOGW(TAG, "Cannot bind WLEDLightEffect to %d.", port_);
-      return;
+  if (!this->bind_())
+    return;
+
+  if (!this->allocate_buffers_(it))
+    return;
+
+  this->receive_(it);
+
+  if (this->frames_queued_ > 0) {
+    const uint32_t now = millis();
+    const uint32_t age = now - this->slots_[this->slot_head_].received_at;
+    // Show buffered frames at the pace they were sent, but never let them fall further behind than twice the
+    // buffer time
+    if ((age >= this->jitter_buffer_ && now - this->last_frame_shown_ >= this->frame_interval_) ||
+        age >= 2 * this->jitter_buffer_) {
+      this->present_frame_(it);
+      if (now - this->last_frame_shown_ < 2 * this->frame_interval_) {
+        this->last_frame_shown_ += this->frame_interval_;
+      } else {
+        this->last_frame_shown_ = now;
+      }
     }
   }
 
-  std::vector<uint8_t> payload;
-  while (uint16_t packet_size = udp_->parsePacket()) {
-    payload.resize(packet_size);
+  // FIXME: Use roll-over safe arithmetic
+  if (blank_at_ < millis()) {
+    blank_all_leds_(it);
+    blank_at_ = millis() + DEFAULT_BLANK_TIME;
+  }
+}
+
+#ifdef USE_ARDUINO
+bool WLEDLightEffect::bind_() {
+  if (this->udp_)
+    return true;
+  this->udp_ = make_unique<WiFiUDP>();
+  if (!this->udp_->begin(this->port_)) {
+    ESP_LOGW(TAG, "Cannot bind WLEDLightEffect to %d.", this->port_);
+    this->udp_.reset();
+    return false;
+  }
+  return true;
+}
 
-    if (!udp_->read(&payload[0], payload.size())) {
+int WLEDLightEffect::read_packet_() {
+  while (uint16_t packet_size = this->udp_->parsePacket()) {
+    if (packet_size > MAX_PACKET_SIZE) {
+      ESP_LOGD(TAG, "Frame: Too large (size=%u).", packet_size);
       continue;
     }
+    int size = this->udp_->read(this->receive_buffer_, packet_size);
+    if (size > 0)
+      return size;
+  }
+  return 0;
+}
+#else
+bool WLEDLightEffect::bind_() {
+  if (this->socket_)
+    return true;
+  this->socket_ = socket::socket_ip(SOCK_DGRAM, IPPROTO_IP);
+  if (this->socket_ == nullptr) {
+    ESP_LOGW(TAG, "Cannot create socket for WLEDLightEffect.");
+    return false;
+  }
 
-    if (!this->parse_frame_(it, &payload[0], payload.size())) {
-      ESP_LOGD(TAG, "Frame: Invalid (size=%zu, first=0x%02X).", payload.size(), payload[0]);
-      continue;
+  int enable = 1;
+  this->socket_->setsockopt(SOL_SOCKET, SO_REUSEADDR, &enable, sizeof(int));
+  struct sockaddr_storage server;
+  socklen_t sl = socket::set_sockaddr_any((struct sockaddr *) &server, sizeof(server), this->port_);
+  if (this->socket_->setblocking(false) != 0 || sl == 0 ||
+      this->socket_->bind((struct sockaddr *) &server, sizeof(server)) != 0) {
+    ESP_LOGW(TAG, "Cannot bind WLEDLightEffect to %d: errno %d", this->port_, errno);
+    this->socket_->close();
+    this->socket_.reset();
+    return false;
+  }
+  return true;
+}
+
+int WLEDLightEffect::read_packet_() {
+  // One byte more than the largest datagram, to tell too large ones that were cut short
+  while (true) {
+    ssize_t size = this->socket_->read(this->receive_buffer_, MAX_PACKET_SIZE + 1);
+    if (size <= 0)
+      return 0;
+    if (size <= MAX_PACKET_SIZE)
+      return size;
+    ESP_LOGD(TAG, "Frame: Too large (size=%zd).", size);
+  }
+}
+#endif
+
+bool WLEDLightEffect::allocate_buffers_(light::AddressableLight &it) {
+  if (this->receive_buffer_ != nullptr)
+    return true;
+
+  ExternalRAMAllocator<uint8_t> allocator(ExternalRAMAllocator<uint8_t>::ALLOW_FAILURE);
+  this->receive_buffer_ = allocator.allocate(MAX_PACKET_SIZE + 1);
+  if (this->receive_buffer_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate receive buffer.");
+    return false;
+  }
+  if (this->jitter_buffer_ == 0)
+    return true;
+
+  // A frame carries at most 4 bytes per LED, plus a DDP header for every full datagram it takes
+  const size_t data_size = it.size() * 4;
+  const size_t max_data = MAX_PACKET_SIZE - DDP_HEADER_SIZE - DDP_TIMECODE_SIZE;
+  const size_t frame_size = data_size + (data_size / max_data + 1) * (DDP_HEADER_SIZE + DDP_TIMECODE_SIZE);
+  this->pool_size_ = JITTER_BUFFER_FRAMES * frame_size;
+  this->pool_ = allocator.allocate(this->pool_size_);
+  if (this->pool_ == nullptr) {
+    ESP_LOGE(TAG, "Cannot allocate jitter buffer of %zu bytes.", this->pool_size_);
+    this->pool_size_ = 0;
+    return false;
+  }
+  this->slots_.resize(JITTER_BUFFER_SLOTS);
+  return true;
+}
+
+void WLEDLightEffect::receive_(light::AddressableLight &it) {
+  // Drain everything that arrived since the last frame, so bursts don't pile up in the network stack
+  while (int size = this->read_packet_()) {
+    if (this->jitter_buffer_ > 0) {
+      this->buffer_packet_(it, this->receive_buffer_, size);
+    } else if (!this->parse_frame_(it, this->receive_buffer_, size)) {
+      ESP_LOGD(TAG, "Frame: Invalid (size=%d, first=0x%02X).", size, this->receive_buffer_[0]);
     }
   }
+}
 
-  // FIXME: Use roll-over safe arithmetic
-  if (blank_at_ < millis()) {
-    blank_all_leds_(it);
-    blank_at_ = millis() + DEFAULT_BLANK_TIME;
+void WLEDLightEffect::buffer_packet_(light::AddressableLight &it, const uint8_t *payload, uint16_t size) {
+  // WLED frames are always a single datagram, while DDP frames end with the one that has the push flag set
+  const bool frame_end = !is_ddp(payload, size) || (payload[0] & DDP_FLAG_PUSH);
+
+  uint8_t *data = nullptr;
+  while (!this->bypass_frame_) {
+    if (this->slot_count_ < this->slots_.size() && (data = this->reserve_(size)) != nullptr)
+      break;
+    if (this->frames_queued_ == 0) {
+      // The frame being received takes more room than the whole buffer: show what has arrived of it right away
+      // and let the rest of it through unbuffered
+      ESP_LOGV(TAG, "Frame larger than the jitter buffer, showing it unbuffered.");
+      while (this->slot_count_ > 0) {
+        const auto &slot = this->slots_[this->slot_head_];
+        this->parse_frame_(it, slot.data, slot.size);
+        this->slot_head_ = (this->slot_head_ + 1) % this->slots_.size();
+        this->slot_count_--;
+      }
+      this->bypass_frame_ = true;
+      break;
+    }
+    this->drop_oldest_frame_();
+    this->dropped_++;
+    ESP_LOGV(TAG, "Jitter buffer full, dropped a frame (%u dropped in total).", this->dropped_);
+  }
+
+  const uint32_t now = millis();
+  if (this->bypass_frame_) {
+    if (!this->parse_frame_(it, payload, size))
+      ESP_LOGD(TAG, "Frame: Invalid (size=%u, first=0x%02X).", size, payload[0]);
+    this->bypass_frame_ = !frame_end;
+    this->last_frame_shown_ = now;
+    return;
+  }
+
+  auto &slot = this->slots_[(this->slot_head_ + this->slot_count_) % this->slots_.size()];
+  memcpy(data, payload, size);
+  slot.data = data;
+  slot.size = size;
+  slot.received_at = now;
+  slot.frame_end = frame_end;
+  this->slot_count_++;
+
+  if (!slot.frame_end)
+    return;
+  this->frames_queued_++;
+  const uint32_t interval = now - this->last_frame_received_;
+  if (this->last_frame_received_ != 0 && interval < MAX_FRAME_INTERVAL) {
+    if (this->frame_interval_ == 0) {
+      this->frame_interval_ = interval;
+    } else {
+      this->frame_interval_ = (this->frame_interval_ * 7 + interval) / 8;
+    }
+  }
+  this->last_frame_received_ = now;
+}
+
+uint8_t *WLEDLightEffect::reserve_(uint16_t size) {
+  if (this->slot_count_ == 0)
+    return size <= this->pool_size_ ? this->pool_ : nullptr;
+
+  const auto &oldest = this->slots_[this->slot_head_];
+  const auto &newest = this->slots_[(this->slot_head_ + this->slot_count_ - 1) % this->slots_.size()];
+  uint8_t *begin = oldest.data;
+  uint8_t *end = newest.data + newest.size;
+  if (end > begin) {
+    // The buffered datagrams are in one piece: use the room after them, or wrap around to the start of the pool
+    if (size_t(this->pool_ + this->pool_size_ - end) >= size)
+      return end;
+    return size_t(begin - this->pool_) >= size ? this->pool_ : nullptr;
+  }
+  return size_t(begin - end) >= size ? end : nullptr;
+}
+
+void WLEDLightEffect::present_frame_(light::AddressableLight &it) {
+  while (this->slot_count_ > 0) {
+    const auto &slot = this->slots_[this->slot_head_];
+    this->slot_head_ = (this->slot_head_ + 1) % this->slots_.size();
+    this->slot_count_--;
+
+    if (!this->parse_frame_(it, slot.data, slot.size)) {
+      ESP_LOGD(TAG, "Frame: Invalid (size=%u, first=0x%02X).", slot.size, slot.data[0]);
+    }
+    if (slot.frame_end) {
+      this->frames_queued_--;
+      return;
+    }
+  }
+}
+
+void WLEDLightEffect::drop_oldest_frame_() {
+  while (this->slot_count_ > 0) {
+    const bool frame_end = this->slots_[this->slot_head_].frame_end;
+    this->slot_head_ = (this->slot_head_ + 1) % this->slots_.size();
+    this->slot_count_--;
+
+    if (frame_end) {
+      this->frames_queued_--;
+      return;
+    }
   }
 }
 
@@ -88,6 +333,10 @@ bool WLEDLightEffect::parse_frame_(light::AddressableLight &it, const uint8_t *p
     return false;
   }
 
+  if (is_ddp(payload, size)) {
+    return parse_ddp_frame_(it, payload, size);
+  }
+
   uint8_t protocol = payload[0];
   uint8_t timeout = payload[1];
 
@@ -246,7 +495,62 @@ bool WLEDLightEffect::parse_dnrgb_frame_(light::AddressableLight &it, const uint
   return true;
 }
 
+bool WLEDLightEffect::parse_ddp_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size) {
+  // header: flags, sequence, data type, destination, offset (4b), length (2b), optional timecode (4b)
+  uint8_t flags = payload[0];
+  uint8_t type = payload[2];
+  uint8_t destination = payload[3];
+  uint32_t offset = encode_uint32(payload[4], payload[5], payload[6], payload[7]);
+  uint16_t length = encode_uint16(payload[8], payload[9]);
+
+  uint16_t header_size = DDP_HEADER_SIZE;
+  if (flags & DDP_FLAG_TIMECODE)
+    header_size += DDP_TIMECODE_SIZE;
+  if (size < header_size + length) {
+    return false;
+  }
+  payload += header_size;
+
+  // Queries and packets for other destinations (status, configuration) carry no pixel data
+  if ((flags & DDP_FLAG_QUERY) || destination != DDP_ID_DISPLAY) {
+    return true;
+  }
+
+  // Older senders leave the data type empty or only set the RGB bit
+  uint8_t channels;
+  if (type == DDP_TYPE_RGBW) {
+    channels = 4;
+  } else if (type == DDP_TYPE_RGB || type <= 0x01) {
+    channels = 3;
+  } else {
+    return false;
+  }
+
+  // offset is in bytes
+  if ((offset % channels) != 0) {
+    return false;
+  }
+
+  uint32_t led = offset / channels;
+  auto count = length / channels;
+  uint32_t max_leds = it.size();
+
+  for (; count > 0 && led < max_leds; count--, payload += channels, led++) {
+    uint8_t r = payload[0];
+    uint8_t g = payload[1];
+    uint8_t b = payload[2];
+    uint8_t w = channels == 4 ? payload[3] : 0;
+
+    it[led].set(Color(r, g, b, w));
+  }
+
+  blank_at_ = millis() + DEFAULT_BLANK_TIME;
+  // A frame can span several packets, it's complete once the sender pushes it
+  if (flags & DDP_FLAG_PUSH) {
+    it.schedule_show();
+  }
+  return true;
+}
+
 }  // namespace wled
 }  // namespace esphome
-
-#endif  // USE_ARDUINO
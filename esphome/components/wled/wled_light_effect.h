@@ -1,18 +1,29 @@
 #pragma once
 
-#ifdef USE_ARDUINO
-
 #include "esphome/core/component.h"
 #include "esphome/components/light/addressable_light_effect.h"
 
 #include <vector>
 #include <memory>
 
+#ifdef USE_ARDUINO
 class UDP;
+#else
+#include "esphome/components/socket/socket.h"
+#endif
 
 namespace esphome {
 namespace wled {
 
+/// A datagram waiting in the jitter buffer.
+struct WLEDPacketSlot {
+  uint32_t received_at;
+  uint16_t size;
+  /// Whether this is the last datagram of a frame.
+  bool frame_end;
+  uint8_t *data;
+};
+
 class WLEDLightEffect : public light::AddressableLightEffect {
  public:
   WLEDLightEffect(const std::string &name);
@@ -21,8 +32,24 @@ class WLEDLightEffect : public light::AddressableLightEffect {
   void stop() override;
   void apply(light::AddressableLight &it, const Color &current_color) override;
   void set_port(uint16_t port) { this->port_ = port; }
+  /// Delay frames by this many milliseconds to even out bursts, 0 to show them as soon as they arrive.
+  void set_jitter_buffer(uint32_t jitter_buffer) { this->jitter_buffer_ = jitter_buffer; }
+
+  /// Number of frames the jitter buffer had to drop because newer frames needed the room.
+  uint32_t get_dropped_frames() const { return this->dropped_; }
 
  protected:
+  bool bind_();
+  /// Read the next datagram into the receive buffer; returns its size, 0 if there is none.
+  int read_packet_();
+  bool allocate_buffers_(light::AddressableLight &it);
+  void receive_(light::AddressableLight &it);
+  void buffer_packet_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
+  /// Room in the pool for a datagram of `size` bytes after the newest one, or nullptr.
+  uint8_t *reserve_(uint16_t size);
+  void present_frame_(light::AddressableLight &it);
+  void drop_oldest_frame_();
+
   void blank_all_leds_(light::AddressableLight &it);
   bool parse_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_notifier_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
@@ -30,14 +57,37 @@ class WLEDLightEffect : public light::AddressableLightEffect {
   bool parse_drgb_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_drgbw_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
   bool parse_dnrgb_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
+  bool parse_ddp_frame_(light::AddressableLight &it, const uint8_t *payload, uint16_t size);
 
   uint16_t port_{0};
+#ifdef USE_ARDUINO
   std::unique_ptr<UDP> udp_;
+#else
+  std::unique_ptr<socket::Socket> socket_;
+#endif
   uint32_t blank_at_{0};
   uint32_t dropped_{0};
+
+  /// Datagrams are read into this buffer, allocated once.
+  uint8_t *receive_buffer_{nullptr};
+
+  uint32_t jitter_buffer_{0};
+  /// Datagrams of buffered frames, stored back to back; sized to hold a few frames of this light.
+  uint8_t *pool_{nullptr};
+  size_t pool_size_{0};
+  /// Ring of buffered datagrams, oldest at `slot_head_`.
+  std::vector<WLEDPacketSlot> slots_;
+  uint8_t slot_head_{0};
+  uint8_t slot_count_{0};
+  /// The frame being received doesn't fit into the pool, so its datagrams are shown as they arrive.
+  bool bypass_frame_{false};
+  /// Number of complete frames in the ring.
+  uint8_t frames_queued_{0};
+  /// Smoothed time between incoming frames, in milliseconds; frames are shown at this pace.
+  uint32_t frame_interval_{0};
+  uint32_t last_frame_received_{0};
+  uint32_t last_frame_shown_{0};
 };
 
 }  // namespace wled
 }  // namespace esphome
-
-#endif  // USE_ARDUINO
@@ -23,6 +23,8 @@
 #define USE_CLIMATE
 #define USE_COVER
 #define USE_DEEP_SLEEP
+#define USE_DISPLAY
+#define USE_DISPLAY_WIDGETS
 #define USE_FAN
 #define USE_GRAPH
 #define USE_HOMEASSISTANT_TIME
@@ -32,6 +34,8 @@
 #define USE_LOGGER
 #define USE_MDNS
 #define USE_MEDIA_PLAYER
+#define USE_MODBUS_RTU
+#define USE_MODBUS_TCP
 #define USE_MQTT
 #define USE_NUMBER
 #define USE_OTA
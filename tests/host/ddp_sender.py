@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Stand-in DDP sender for the WLED effect of tests/test13.yaml.
+
+Sends frames in which every LED has the same color, so a frame shown while only part of it arrived stands out as a
+torn strip. Each frame is split into datagrams of --leds-per-packet LEDs and only the last one sets the push flag.
+Frames go out in bursts of --burst at an average of --fps, so the jitter buffer of the receiver has to even them out.
+
+    python3 tests/host/ddp_sender.py --leds 300 --leds-per-packet 30
+"""
+import argparse
+import socket
+import struct
+import time
+
+DDP_VERSION_1 = 0x40
+DDP_FLAG_PUSH = 0x01
+DDP_TYPE_RGB = 0x0B
+DDP_ID_DISPLAY = 1
+
+
+def frame_packets(number, leds, leds_per_packet):
+    color = bytes(((number * 3) % 256, (number * 7) % 256, (number * 11) % 256))
+    packets = []
+    for first in range(0, leds, leds_per_packet):
+        count = min(leds_per_packet, leds - first)
+        flags = DDP_VERSION_1
+        if first + count == leds:
+            flags |= DDP_FLAG_PUSH
+        header = struct.pack(
+            ">BBBBIH", flags, number % 15 + 1, DDP_TYPE_RGB, DDP_ID_DISPLAY, first * 3, count * 3
+        )
+        packets.append(header + color * count)
+    return packets
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n", 1)[0])
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=4048)
+    parser.add_argument("--leds", type=int, default=300)
+    parser.add_argument("--leds-per-packet", type=int, default=30)
+    parser.add_argument("--fps", type=float, default=40)
+    parser.add_argument("--burst", type=int, default=2, help="frames sent back to back")
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    number = 0
+    start = time.monotonic()
+    report = start
+    try:
+        while True:
+            for _ in range(args.burst):
+                for packet in frame_packets(number, args.leds, args.leds_per_packet):
+                    sock.sendto(packet, (args.host, args.port))
+                number += 1
+            delay = start + number / args.fps - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+            now = time.monotonic()
+            if now - report >= 10:
+                print(f"{number} frames sent, {number / (now - start):.1f} frames/s", flush=True)
+                report = now
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
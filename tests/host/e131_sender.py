@@ -0,0 +1,95 @@
+#!/usr/bin/env python3
+"""Stand-in E1.31 (sACN) sender for the E1.31 effect of tests/test13.yaml.
+
+Sends frames in which every LED has the same color, so a frame shown while only some of its universes arrived
+stands out as a torn strip. Each frame is one data packet per universe, 170 RGB LEDs each; unless --no-sync is given
+the packets carry a synchronization universe and a sync packet follows them, so the receiver has to hold the
+universes until the frame is complete. 10 universes at the default 100 frames/s are 1000 data packets/s.
+
+    python3 tests/host/e131_sender.py --universes 10 --fps 100
+"""
+import argparse
+import socket
+import struct
+import time
+import uuid
+
+ACN_ID = b"ASC-E1.17\x00\x00\x00"
+VECTOR_ROOT = 4
+VECTOR_ROOT_EXTENDED = 8
+VECTOR_FRAME = 2
+VECTOR_FRAME_SYNCHRONIZATION = 1
+VECTOR_DMP = 2
+LEDS_PER_UNIVERSE = 170
+CID = uuid.uuid4().bytes
+
+
+def flength(length):
+    return 0x7000 | length
+
+
+def data_packet(universe, sync_universe, sequence, values):
+    dmp = struct.pack(">HBBHHH", flength(10 + 1 + len(values)), VECTOR_DMP, 0xA1, 0, 1, 1 + len(values))
+    dmp += b"\x00" + values
+    frame_length = 77 + len(dmp)
+    frame = struct.pack(
+        ">HI64sBHBBH",
+        flength(frame_length),
+        VECTOR_FRAME,
+        b"esphome host test",
+        100,
+        sync_universe,
+        sequence,
+        0,
+        universe,
+    )
+    root = struct.pack(">HH12sHI16s", 0x0010, 0, ACN_ID, flength(22 + frame_length), VECTOR_ROOT, CID)
+    return root + frame + dmp
+
+
+def sync_packet(sync_universe, sequence):
+    frame = struct.pack(">HIBHH", flength(11), VECTOR_FRAME_SYNCHRONIZATION, sequence, sync_universe, 0)
+    return struct.pack(">HH12sHI16s", 0x0010, 0, ACN_ID, flength(22 + 11), VECTOR_ROOT_EXTENDED, CID) + frame
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n", 1)[0])
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=5568)
+    parser.add_argument("--universe", type=int, default=1, help="first universe")
+    parser.add_argument("--universes", type=int, default=10)
+    parser.add_argument("--sync-universe", type=int, default=1000)
+    parser.add_argument("--no-sync", action="store_true", help="apply every universe as it arrives")
+    parser.add_argument("--fps", type=float, default=100)
+    args = parser.parse_args()
+
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    sync_universe = 0 if args.no_sync else args.sync_universe
+    number = 0
+    packets = 0
+    start = time.monotonic()
+    report = start
+    try:
+        while True:
+            color = bytes(((number * 3) % 256, (number * 7) % 256, (number * 11) % 256))
+            sequence = number % 256
+            for universe in range(args.universe, args.universe + args.universes):
+                packet = data_packet(universe, sync_universe, sequence, color * LEDS_PER_UNIVERSE)
+                sock.sendto(packet, (args.host, args.port))
+            packets += args.universes
+            if sync_universe:
+                sock.sendto(sync_packet(sync_universe, sequence), (args.host, args.port))
+            number += 1
+            delay = start + number / args.fps - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+            now = time.monotonic()
+            if now - report >= 10:
+                print(f"{number} frames sent, {packets / (now - start):.0f} data packets/s", flush=True)
+                report = now
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
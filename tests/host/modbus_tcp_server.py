@@ -0,0 +1,108 @@
+#!/usr/bin/env python3
+"""Stand-in Modbus/TCP server for the modbus TCP transport in tests/test12.yaml.
+
+Every unit identifier answers like a device whose holding and input registers hold their own address, and whose coils
+and discrete inputs are set on odd addresses. Writes are acknowledged. Each request is answered after --delay, on its
+own task, so pipelined requests of different units overlap like behind a real gateway.
+
+The server prints the number of requests, the largest number of requests in flight at once and the mean response time
+every --stats seconds. With two or more units polled by the host build, "max in flight" above 1 shows that requests
+are pipelined by transaction id instead of waiting for each other.
+
+    python3 tests/host/modbus_tcp_server.py --port 5020 --delay 0.05
+"""
+import argparse
+import asyncio
+import struct
+import time
+
+
+class Stats:
+    def __init__(self):
+        self.requests = 0
+        self.in_flight = 0
+        self.max_in_flight = 0
+        self.total_time = 0.0
+
+    def report(self):
+        mean = self.total_time / self.requests * 1000 if self.requests else 0.0
+        print(
+            f"{self.requests} requests, max in flight {self.max_in_flight}, mean response time {mean:.1f} ms",
+            flush=True,
+        )
+        self.requests = 0
+        self.max_in_flight = self.in_flight
+        self.total_time = 0.0
+
+
+def build_response(pdu):
+    function_code = pdu[0]
+    if function_code in (0x01, 0x02):
+        start, count = struct.unpack(">HH", pdu[1:5])
+        bits = bytearray((count + 7) // 8)
+        for i in range(count):
+            if (start + i) % 2:
+                bits[i // 8] |= 1 << (i % 8)
+        return bytes([function_code, len(bits)]) + bytes(bits)
+    if function_code in (0x03, 0x04):
+        start, count = struct.unpack(">HH", pdu[1:5])
+        values = b"".join(struct.pack(">H", (start + i) & 0xFFFF) for i in range(count))
+        return bytes([function_code, len(values)]) + values
+    if function_code in (0x05, 0x06, 0x0F, 0x10):
+        return pdu[:5]
+    # Illegal function
+    return bytes([function_code | 0x80, 0x01])
+
+
+async def answer(writer, stats, delay, header, pdu):
+    transaction_id, unit = header[0], header[3]
+    start = time.monotonic()
+    stats.in_flight += 1
+    stats.max_in_flight = max(stats.max_in_flight, stats.in_flight)
+    await asyncio.sleep(delay)
+    response = build_response(pdu)
+    writer.write(struct.pack(">HHHB", transaction_id, 0, len(response) + 1, unit) + response)
+    await writer.drain()
+    stats.in_flight -= 1
+    stats.requests += 1
+    stats.total_time += time.monotonic() - start
+
+
+async def serve_client(reader, writer, stats, delay):
+    peer = writer.get_extra_info("peername")
+    print(f"Connection from {peer}", flush=True)
+    tasks = set()
+    try:
+        while True:
+            header = struct.unpack(">HHHB", await reader.readexactly(7))
+            pdu = await reader.readexactly(header[2] - 1)
+            task = asyncio.create_task(answer(writer, stats, delay, header, pdu))
+            tasks.add(task)
+            task.add_done_callback(tasks.discard)
+    except (asyncio.IncompleteReadError, ConnectionError):
+        print(f"Connection from {peer} closed", flush=True)
+    for task in tasks:
+        task.cancel()
+
+
+async def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=5020)
+    parser.add_argument("--delay", type=float, default=0.05, help="response delay in seconds")
+    parser.add_argument("--stats", type=float, default=10.0, help="statistics interval in seconds")
+    args = parser.parse_args()
+
+    stats = Stats()
+    server = await asyncio.start_server(
+        lambda r, w: serve_client(r, w, stats, args.delay), args.host, args.port
+    )
+    print(f"Serving Modbus/TCP on {args.host}:{args.port}", flush=True)
+    async with server:
+        while True:
+            await asyncio.sleep(args.stats)
+            stats.report()
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -0,0 +1,149 @@
+#!/usr/bin/env python3
+"""Stand-in serial device for the host uart components in tests/test12.yaml and tests/test13.yaml.
+
+Creates one pseudo terminal per --link and symlinks it at that path, so a host build can open it as its uart
+`device:`. With --serial it writes to a serial adapter instead, for components that only build for a board. The same data goes to every link, paced at --baud with 10 bits per byte like a real line. Without --file
+it sends lines of --length bytes ending with CR, shaped like the answers of an inverter; with --file it replays that
+capture over and over. With --adalight it sends Adalight frames for that many LEDs instead, every LED of a frame in
+the same color, so a strip showing more than one color shows a torn frame. With --dsmr it sends DSMR 5 telegrams
+with valid checksums, in which the tariff 1 energy counts up by 0.001 kWh per telegram and a long text message
+makes one line much longer than the others.
+
+Start it before the host build, which opens its devices during setup:
+
+    python3 tests/host/uart_feeder.py --link /tmp/esphome-uart-bytes --link /tmp/esphome-uart-frames
+    python3 tests/host/uart_feeder.py --link /tmp/esphome-uart-adalight --baud 2000000 --adalight 300
+    python3 tests/host/uart_feeder.py --serial /dev/ttyUSB0 --dsmr
+"""
+import argparse
+import os
+import random
+import termios
+import time
+import tty
+
+
+def generated_lines(length):
+    while True:
+        line = "("
+        while len(line) < length - 1:
+            line += f"{random.uniform(0, 500):05.1f} "
+        yield line[: length - 1].encode() + b"\r"
+
+
+def adalight_frames(leds):
+    count = leds - 1
+    header = b"Ada" + bytes((count >> 8, count & 0xFF, (count >> 8) ^ (count & 0xFF) ^ 0x55))
+    number = 0
+    while True:
+        color = bytes(((number * 3) % 256, (number * 7) % 256, (number * 11) % 256))
+        yield header + color * leds
+        number += 1
+
+
+def dsmr_crc(data):
+    crc = 0
+    for byte in data:
+        crc ^= byte
+        for _ in range(8):
+            crc = (crc >> 1) ^ 0xA001 if crc & 1 else crc >> 1
+    return crc
+
+
+def dsmr_telegrams():
+    number = 0
+    message = ("Replayed telegram " * 60)[:1024].encode().hex().upper()
+    while True:
+        lines = [
+            "/ISk5\\2MT382-1000",
+            "",
+            "1-3:0.2.8(50)",
+            "0-0:1.0.0(230101120000W)",
+            "0-0:96.1.1(4B384547303034303436333935353037)",
+            f"1-0:1.8.1({number / 1000:010.3f}*kWh)",
+            "1-0:1.8.2(000001.000*kWh)",
+            "0-0:96.14.0(0001)",
+            "1-0:1.7.0(00.193*kW)",
+            f"0-0:96.13.0({message})",
+            "0-1:24.2.1(230101120000W)(00012.345*m3)",
+        ]
+        body = ("\r\n".join(lines) + "\r\n!").encode()
+        yield body + f"{dsmr_crc(body):04X}\r\n".encode()
+        number += 1
+
+
+def replayed(path):
+    with open(path, "rb") as file:
+        data = file.read()
+    while True:
+        yield data
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n", 1)[0])
+    parser.add_argument("--link", action="append", default=[], help="path of a device to create")
+    parser.add_argument("--serial", action="append", default=[], help="serial adapter to write to")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--length", type=int, default=110, help="length of the generated lines")
+    parser.add_argument("--file", help="capture to replay instead of generated lines")
+    parser.add_argument("--adalight", type=int, metavar="LEDS", help="send Adalight frames for this many LEDs")
+    parser.add_argument("--dsmr", action="store_true", help="send DSMR telegrams")
+    parser.add_argument("--chunk", type=int, default=64, help="bytes written at once")
+    args = parser.parse_args()
+    if not args.link and not args.serial:
+        parser.error("at least one --link or --serial is required")
+
+    masters = []
+    for link in args.link:
+        master, slave = os.openpty()
+        tty.setraw(slave)
+        if os.path.lexists(link):
+            os.unlink(link)
+        os.symlink(os.ttyname(slave), link)
+        masters.append(master)
+        print(f"{link} -> {os.ttyname(slave)}", flush=True)
+    for device in args.serial:
+        fd = os.open(device, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(fd)
+        attributes = termios.tcgetattr(fd)
+        attributes[4] = attributes[5] = getattr(termios, f"B{args.baud}")
+        termios.tcsetattr(fd, termios.TCSANOW, attributes)
+        masters.append(fd)
+
+    if args.adalight:
+        source = adalight_frames(args.adalight)
+    elif args.dsmr:
+        source = dsmr_telegrams()
+    elif args.file:
+        source = replayed(args.file)
+    else:
+        source = generated_lines(args.length)
+    byte_time = 10.0 / args.baud
+    sent = 0
+    start = time.monotonic()
+    report = start
+    try:
+        for data in source:
+            for offset in range(0, len(data), args.chunk):
+                chunk = data[offset : offset + args.chunk]
+                for master in masters:
+                    os.write(master, chunk)
+                sent += len(chunk)
+                # Keep to the line rate on average, however the writes are scheduled
+                delay = start + sent * byte_time - time.monotonic()
+                if delay > 0:
+                    time.sleep(delay)
+            now = time.monotonic()
+            if now - report >= 10:
+                print(f"{sent} bytes sent, {sent / (now - start):.0f} bytes/s", flush=True)
+                report = now
+    except KeyboardInterrupt:
+        pass
+    finally:
+        for link in args.link:
+            if os.path.islink(link):
+                os.unlink(link)
+
+
+if __name__ == "__main__":
+    main()